@@ -188,6 +188,8 @@
 #cmakedefine HAVE_POLL 1
 #cmakedefine HAVE_POSIX_FALLOCATE 1
 #cmakedefine HAVE_FALLOC_PUNCH_HOLE_AND_KEEP_SIZE 1
+#cmakedefine HAVE_RWF_ATOMIC 1
+#cmakedefine HAVE_LIBAIO_RW_FLAGS 1
 #cmakedefine HAVE_PREAD 1
 #cmakedefine HAVE_READ_REAL_TIME 1
 #cmakedefine HAVE_PTHREAD_ATTR_CREATE 1
@@ -984,6 +984,20 @@ IF(NOT MSVC)
   )
 ENDIF()
 
+IF(CMAKE_SYSTEM_NAME STREQUAL "Linux")
+  CHECK_C_SOURCE_COMPILES(
+  "
+  #define _GNU_SOURCE
+  #include <sys/uio.h>
+  int main()
+  {
+    struct iovec iov= {0, 0};
+    return (int) pwritev2(0, &iov, 1, 0, RWF_ATOMIC);
+  }"
+  HAVE_RWF_ATOMIC
+  )
+ENDIF()
+
 MY_CHECK_C_COMPILER_FLAG("-Werror")
 IF(have_C__Werror)
   SET(SAVE_CMAKE_REQUIRED_FLAGS ${CMAKE_REQUIRED_FLAGS})
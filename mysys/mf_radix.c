@@ -19,19 +19,33 @@
   A very quick sort for not to long (< 20 char) strings.
   Neads a extra buffers of number_of_elements pointers but is
   2-3 times faster than quicksort
+
+  Small arrays are sorted least significant byte first. For large
+  arrays, the passes of the LSD sort would scatter the pointers all over
+  memory, so they are sorted most significant byte first: after the
+  first pass, the buckets are small enough to stay in the CPU cache,
+  and the sort of a bucket ends as soon as its keys differ.
+  Both variants are stable.
 */
 
 #include "mysys_priv.h"
 #include <m_string.h>
 
+/* Arrays of at least this many elements are sorted MSD first */
+#define RADIX_MSD_MIN_ELEMENTS 100000
+/* MSD buckets smaller than this are sorted by insertion sort */
+#define RADIX_MSD_INSERTION_SORT 32
+
 	/* Radixsort */
 
 my_bool radixsort_is_applicable(uint n_items, size_t size_of_element)
 {
-  return size_of_element <= 20 && n_items >= 1000 && n_items < 100000;
+  return size_of_element <= 20 && n_items >= 1000;
 }
 
-void radixsort_for_str_ptr(uchar **base, uint number_of_elements, size_t size_of_element, uchar **buffer)
+
+static void radixsort_lsd(uchar **base, uint number_of_elements,
+                          size_t size_of_element, uchar **buffer)
 {
   uchar **end,**ptr,**buffer_ptr;
   uint32 *count_ptr,*count_end,count[256];
@@ -58,3 +72,89 @@ void radixsort_for_str_ptr(uchar **base, uint number_of_elements, size_t size_of
   next:;
   }
 }
+
+
+/*
+  Stable insertion sort of pointers to strings that are equal in the
+  first 'pass' bytes
+*/
+
+static void radixsort_insertion(uchar **base, size_t number_of_elements,
+                                size_t pass, size_t size_of_element)
+{
+  uchar **end= base + number_of_elements, **ptr, **prev;
+  size_t length= size_of_element - pass;
+
+  for (ptr= base + 1 ; ptr < end ; ptr++)
+  {
+    uchar *key= *ptr;
+    for (prev= ptr ; prev != base && memcmp(prev[-1] + pass, key + pass,
+                                            length) > 0 ; prev--)
+      *prev= prev[-1];
+    *prev= key;
+  }
+}
+
+
+/*
+  Sort pointers to strings that are equal in the first 'pass' bytes
+  by byte 'pass', and then each bucket by the following bytes
+*/
+
+static void radixsort_msd(uchar **base, uint number_of_elements,
+                          size_t pass, size_t size_of_element,
+                          uchar **buffer)
+{
+  uchar **end, **ptr;
+  uint count[256], start, i;
+
+  for (;;)
+  {
+    if (number_of_elements < RADIX_MSD_INSERTION_SORT)
+    {
+      radixsort_insertion(base, number_of_elements, pass, size_of_element);
+      return;
+    }
+
+    end= base + number_of_elements;
+    bzero((uchar*) count, sizeof(count));
+    for (ptr= base ; ptr < end ; ptr++)
+      count[ptr[0][pass]]++;
+    if (count[base[0][pass]] != number_of_elements)
+      break;
+    /* All keys have the same byte; continue with the next one */
+    if (++pass == size_of_element)
+      return;
+  }
+
+  for (i= 0, start= 0 ; i < 256 ; i++)
+  {
+    uint n= count[i];
+    count[i]= start;
+    start+= n;
+  }
+  for (ptr= base ; ptr < end ; ptr++)
+    buffer[count[ptr[0][pass]]++]= *ptr;
+  memcpy(base, buffer, number_of_elements * sizeof(*base));
+
+  if (++pass == size_of_element)
+    return;
+
+  /* count[i] is now the end of bucket i */
+  for (i= 0, start= 0 ; i < 256 ; i++)
+  {
+    if (count[i] - start > 1)
+      radixsort_msd(base + start, count[i] - start, pass, size_of_element,
+                    buffer + start);
+    start= count[i];
+  }
+}
+
+
+void radixsort_for_str_ptr(uchar **base, uint number_of_elements, size_t size_of_element, uchar **buffer)
+{
+  if (number_of_elements < RADIX_MSD_MIN_ELEMENTS)
+    radixsort_lsd(base, number_of_elements, size_of_element, buffer);
+  else if (size_of_element)
+    radixsort_msd(base, number_of_elements, 0, size_of_element, buffer);
+}
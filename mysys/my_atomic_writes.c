@@ -429,6 +429,41 @@ static my_bool sfx_could_disable_punch_hole(File file)
   return 0;
 }
 
+/***********************************************************************
+  Torn-write protection of the Linux kernel (RWF_ATOMIC)
+************************************************************************/
+
+#ifdef STATX_WRITE_ATOMIC
+#include <fcntl.h>
+
+/**
+   Check if writes of a page to a file can be made atomic by submitting
+   them with the RWF_ATOMIC flag (Linux 6.11 or later).
+   @param[in] file              OS file handle
+   @param[in] page_size         page size
+   @return TRUE                 Atomic write supported
+
+   @notes
+   The kernel only guarantees atomicity for direct I/O whose length is
+   within the reported atomic write unit range.
+*/
+
+static my_bool statx_has_atomic_write(File file, int page_size)
+{
+  struct statx stx;
+  int flags= fcntl(file, F_GETFL);
+
+  if (flags == -1 || !(flags & O_DIRECT) ||
+      statx(file, "", AT_EMPTY_PATH, STATX_WRITE_ATOMIC, &stx) ||
+      !(stx.stx_mask & STATX_WRITE_ATOMIC) ||
+      !(stx.stx_attributes & STATX_ATTR_WRITE_ATOMIC))
+    return 0;
+
+  return (uint) page_size >= stx.stx_atomic_write_unit_min &&
+    (uint) page_size <= stx.stx_atomic_write_unit_max;
+}
+#endif /* STATX_WRITE_ATOMIC */
+
 /***********************************************************************
   Generic atomic write code
 ************************************************************************/
@@ -490,6 +525,27 @@ my_bool my_test_if_atomic_write(File handle, int page_size)
 }
 
 
+/**
+  Check if writes to a file are atomic when they are submitted with
+  the RWF_ATOMIC flag. Unlike my_test_if_atomic_write(), this does not
+  depend on any specific device.
+
+  @return FALSE   No atomic write support
+          TRUE    Page writes with RWF_ATOMIC are atomic
+*/
+
+my_bool my_test_if_rwf_atomic(File handle, int page_size)
+{
+#ifdef STATX_WRITE_ATOMIC
+  return statx_has_atomic_write(handle, page_size);
+#else
+  (void) handle;
+  (void) page_size;
+  return 0;
+#endif
+}
+
+
 /**
   Check if a file resides on thinly provisioned storage.
 
@@ -273,6 +273,7 @@ SORT_INFO *filesort(THD *thd, TABLE *table, Filesort *filesort,
 
   param.set_all_read_bits= filesort->set_all_read_bits;
   param.unpack= filesort->unpack;
+  param.max_sort_threads= thd->variables.max_sort_threads;
 
   sort->addon_fields=  param.addon_fields;
   sort->sort_keys= param.sort_keys;
@@ -520,6 +521,7 @@ SORT_INFO *filesort(THD *thd, TABLE *table, Filesort *filesort,
       outfile->end_of_file=save_pos;
     }
   }
+  tracker->report_sort_threads(param.sort_threads_used);
   tracker->report_merge_passes_at_end(thd, thd->query_plan_fsort_passes);
   if (unlikely(error))
   {
@@ -1115,7 +1117,8 @@ write_keys(Sort_param *param,  SORT_INFO *fs_info, uint count,
   Merge_chunk buffpek;
   DBUG_ENTER("write_keys");
 
-  fs_info->sort_buffer(param, count);
+  set_if_bigger(param->sort_threads_used,
+                fs_info->sort_buffer(param, count));
 
   if (!my_b_inited(tempfile) &&
       open_cached_file(tempfile, mysql_tmpdir, TEMP_PREFIX, DISK_CHUNK_SIZE,
@@ -1517,7 +1520,8 @@ static bool save_index(Sort_param *param, uint count,
   DBUG_ENTER("save_index");
   DBUG_ASSERT(table_sort->record_pointers == 0);
 
-  table_sort->sort_buffer(param, count);
+  set_if_bigger(param->sort_threads_used,
+                table_sort->sort_buffer(param, count));
 
   if (param->using_addon_fields())
   {
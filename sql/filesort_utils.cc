@@ -20,6 +20,13 @@
 #include "sql_sort.h"
 #include "table.h"
 #include "optimizer_defaults.h"
+#include <tpool.h>
+#include <algorithm>
+#include <atomic>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <vector>
 
 PSI_memory_key key_memory_Filesort_buffer_sort_keys;
 
@@ -70,6 +77,29 @@ double get_qsort_sort_cost(ha_rows num_rows, bool with_addon_fields)
 }
 
 
+/**
+  Compute the cost of sorting a sort buffer of num_rows rows, when up to
+  sort_threads threads may take part in the sort.
+
+  Every thread sorts its own part of the buffer, and the sorted parts are
+  then merged pairwise. Each of the log2(parts) merge rounds makes one
+  pass over all the keys.
+*/
+
+static
+double get_sort_buffer_cost(ha_rows num_rows, bool with_addon_fields,
+                            uint sort_threads)
+{
+  const uint parts= filesort_sort_threads(num_rows, sort_threads);
+  if (parts <= 1)
+    return get_qsort_sort_cost(num_rows, with_addon_fields);
+
+  return get_qsort_sort_cost(num_rows / parts, with_addon_fields) +
+         ceil(log2((double) parts)) * num_rows *
+         (DEFAULT_KEY_COPY_COST + DEFAULT_KEY_COMPARE_COST);
+}
+
+
 /**
   Compute the cost of sorting num_rows and only retrieving queue_size rows.
   @param num_rows           How many rows will be sorted.
@@ -132,7 +162,8 @@ double get_merge_many_buffs_cost_fast(ha_rows num_rows,
                                       size_t elem_size,
                                       double key_compare_cost,
                                       double disk_read_cost,
-                                      bool with_addon_fields)
+                                      bool with_addon_fields,
+                                      uint sort_threads)
 {
   DBUG_ASSERT(num_keys_per_buffer != 0);
 
@@ -142,10 +173,12 @@ double get_merge_many_buffs_cost_fast(ha_rows num_rows,
   double full_buffer_sort_cost;
 
   /* Calculate cost for sorting all merge buffers + the last one. */
-  full_buffer_sort_cost= get_qsort_sort_cost(num_keys_per_buffer,
-                                             with_addon_fields);
+  full_buffer_sort_cost= get_sort_buffer_cost(num_keys_per_buffer,
+                                              with_addon_fields,
+                                              sort_threads);
   total_cost= (num_buffers * full_buffer_sort_cost +
-               get_qsort_sort_cost(last_n_elems, with_addon_fields));
+               get_sort_buffer_cost(last_n_elems, with_addon_fields,
+                                    sort_threads));
 
   if (num_buffers >= MERGEBUFF2)
     total_cost+= TMPFILE_CREATE_COST * 2;       // We are creating 2 files.
@@ -277,7 +310,7 @@ void Sort_costs::compute_merge_sort_costs(Sort_param *param,
       get_merge_many_buffs_cost_fast(num_rows, num_available_keys,
                                      row_length, DEFAULT_KEY_COMPARE_COST,
                                      default_optimizer_costs.disk_read_cost,
-                                     false) +
+                                     false, param->max_sort_threads) +
       file->cost(file->ha_rnd_pos_call_time(MY_MIN(param->limit_rows, num_rows)));
   }
   if (with_addon_fields)
@@ -291,7 +324,7 @@ void Sort_costs::compute_merge_sort_costs(Sort_param *param,
         get_merge_many_buffs_cost_fast(num_rows, num_available_keys,
                                        row_length, DEFAULT_KEY_COMPARE_COST,
                                        DISK_READ_COST_THD(thd),
-                                       true);
+                                       true, param->max_sort_threads);
   }
 
   /*
@@ -383,32 +416,218 @@ void Filesort_buffer::free_sort_buffer()
 }
 
 
-void Filesort_buffer::sort_buffer(const Sort_param *param, uint count)
+/**
+  Sort an array of keys with one thread.
+
+  @param param   Sort parameters
+  @param keys    Keys to sort
+  @param count   Number of keys
+  @param buffer  Work area for count pointers, or NULL if not available
+*/
+
+static void sort_keys(const Sort_param *param, uchar **keys, size_t count,
+                      uchar **buffer)
+{
+  size_t size= param->sort_length;
+
+  if (buffer && !param->using_packed_sortkeys() &&
+      radixsort_is_applicable((uint) count, param->sort_length))
+  {
+    radixsort_for_str_ptr(keys, (uint) count, param->sort_length, buffer);
+    return;
+  }
+
+  my_qsort2(keys, count, sizeof(uchar*),
+            param->get_compare_function(),
+            param->get_compare_argument(&size));
+}
+
+
+/** Threads that sort parts of sort buffers, created on first use */
+static tpool::thread_pool *sort_thread_pool;
+/** Limits the number of sort tasks that run at the same time */
+static tpool::task_group *sort_task_group;
+/** Protects sort_thread_pool and sort_task_group */
+static std::mutex sort_thread_pool_mutex;
+
+static void sort_thread_init() { my_thread_init(); }
+static void sort_thread_end() { my_thread_end(); }
+
+/** @return the pool for sort tasks, or NULL if it could not be created */
+static tpool::thread_pool *get_sort_thread_pool()
+{
+  std::lock_guard<std::mutex> lk(sort_thread_pool_mutex);
+  if (!sort_thread_pool)
+  {
+    const int n_cpus= (int) MY_MAX(my_getncpus(), 1);
+    sort_task_group= new (std::nothrow) tpool::task_group(n_cpus);
+    if (!sort_task_group)
+      return NULL;
+    sort_thread_pool= tpool::create_thread_pool_generic(1, n_cpus);
+    if (!sort_thread_pool)
+    {
+      delete sort_task_group;
+      sort_task_group= NULL;
+      return NULL;
+    }
+    sort_thread_pool->set_thread_callbacks(sort_thread_init, sort_thread_end);
+  }
+  return sort_thread_pool;
+}
+
+
+void filesort_free_thread_pool()
+{
+  std::lock_guard<std::mutex> lk(sort_thread_pool_mutex);
+  delete sort_thread_pool;
+  sort_thread_pool= NULL;
+  delete sort_task_group;
+  sort_task_group= NULL;
+}
+
+
+/** Parts of a sort, executed by the sorting thread and by sort tasks */
+class Sort_parts
+{
+  const std::function<void(uint)> &m_func;
+  const uint m_n_parts;
+  std::atomic<uint> m_next;
+public:
+  Sort_parts(const std::function<void(uint)> &func, uint n_parts)
+    : m_func(func), m_n_parts(n_parts), m_next(0) {}
+
+  /** Execute parts until all of them have been started */
+  void run()
+  {
+    for (uint i; (i= m_next.fetch_add(1)) < m_n_parts; )
+      m_func(i);
+  }
+
+  static void run_task(void *parts) { static_cast<Sort_parts*>(parts)->run(); }
+};
+
+
+/**
+  Invoke func(i) for i in [0, n_parts), in parallel in sort tasks.
+
+  The calling thread takes part in the work, and it executes any parts
+  that no task has started. Thus, if the pool is busy or tasks cannot be
+  submitted, the parts are executed serially by the calling thread.
+*/
+
+static void run_in_tasks(uint n_parts, const std::function<void(uint)> &func)
+{
+  Sort_parts parts(func, n_parts);
+  std::vector<std::unique_ptr<tpool::waitable_task>> tasks;
+
+  if (tpool::thread_pool *pool= get_sort_thread_pool())
+  {
+    tasks.reserve(n_parts - 1);
+    for (uint i= 1; i < n_parts; i++)
+    {
+      tpool::waitable_task *task=
+        new (std::nothrow) tpool::waitable_task(Sort_parts::run_task, &parts,
+                                                sort_task_group);
+      if (!task)
+        break;
+      tasks.emplace_back(task);
+      pool->submit_task(task);
+    }
+  }
+
+  parts.run();
+
+  for (std::unique_ptr<tpool::waitable_task> &task : tasks)
+  {
+    /* Tasks that are still queued would find nothing to do. */
+    sort_task_group->cancel_pending(task.get());
+    task->wait();
+  }
+}
+
+
+/**
+  Sort an array of keys with several threads: each sort task sorts a
+  contiguous part of the array, and then the sorted parts are merged
+  pairwise, with the merges of each round executed in parallel tasks.
+
+  @param param      Sort parameters
+  @param keys       Keys to sort
+  @param count      Number of keys
+  @param buffer     Work area for count pointers
+  @param n_threads  Number of parts to sort in parallel
+*/
+
+static void sort_keys_parallel(const Sort_param *param, uchar **keys,
+                               size_t count, uchar **buffer, uint n_threads)
+{
+  std::vector<size_t> bounds(n_threads + 1);
+  for (uint i= 0; i <= n_threads; i++)
+    bounds[i]= count * i / n_threads;
+
+  run_in_tasks(n_threads, [&](uint i) {
+    sort_keys(param, keys + bounds[i], bounds[i + 1] - bounds[i],
+              buffer + bounds[i]);
+  });
+
+  size_t size= param->sort_length;
+  const qsort2_cmp cmp= param->get_compare_function();
+  const void *cmp_arg= param->get_compare_argument(&size);
+  auto less= [cmp, cmp_arg](const uchar *a, const uchar *b)
+  { return cmp(cmp_arg, &a, &b) < 0; };
+
+  uchar **from= keys, **to= buffer;
+  for (uint parts= n_threads; parts > 1; parts= (parts + 1) / 2)
+  {
+    /* Merge the parts 2*i and 2*i+1; an odd last part is copied as is */
+    const uint n_merges= (parts + 1) / 2;
+    run_in_tasks(n_merges, [&](uint i) {
+      const size_t start= bounds[2 * i];
+      const size_t mid= bounds[MY_MIN(2 * i + 1, parts)];
+      const size_t end= bounds[MY_MIN(2 * i + 2, parts)];
+      std::merge(from + start, from + mid, from + mid, from + end,
+                 to + start, less);
+    });
+    for (uint i= 0; i <= n_merges; i++)
+      bounds[i]= bounds[MY_MIN(2 * i, parts)];
+    std::swap(from, to);
+  }
+
+  if (from != keys)
+    memcpy(keys, from, count * sizeof *keys);
+}
+
+
+uint Filesort_buffer::sort_buffer(const Sort_param *param, uint count)
 {
   size_t size= param->sort_length;
   m_sort_keys= get_sort_keys();
 
   if (count <= 1 || size == 0)
-    return;
+    return 1;
 
   // don't reverse for PQ, it is already done
   if (!param->using_pq)
     reverse_record_pointers();
 
+  uint n_threads= filesort_sort_threads(count, param->max_sort_threads);
   uchar **buffer= NULL;
-  if (!param->using_packed_sortkeys() &&
-      radixsort_is_applicable(count, param->sort_length) &&
+  if ((n_threads > 1 ||
+       (!param->using_packed_sortkeys() &&
+        radixsort_is_applicable(count, param->sort_length))) &&
       (buffer= (uchar**) my_malloc(PSI_INSTRUMENT_ME, count*sizeof(char*),
                                    MYF(MY_THREAD_SPECIFIC))))
   {
-    radixsort_for_str_ptr(m_sort_keys, count, param->sort_length, buffer);
+    if (n_threads > 1)
+      sort_keys_parallel(param, m_sort_keys, count, buffer, n_threads);
+    else
+      sort_keys(param, m_sort_keys, count, buffer);
     my_free(buffer);
-    return;
+    return n_threads;
   }
 
-  my_qsort2(m_sort_keys, count, sizeof(uchar*),
-            param->get_compare_function(),
-            param->get_compare_argument(&size));
+  sort_keys(param, m_sort_keys, count, NULL);
+  return 1;
 }
 
 
@@ -466,6 +685,7 @@ double cost_of_filesort(TABLE *table, ORDER *order_by, ha_rows rows_to_read,
   /* Fill in the Sort_param structure so we can compute the sort costs */
   param.setup_lengths_and_limit(table, sort_len, addon_field_length,
                                 limit_rows);
+  param.max_sort_threads= thd->variables.max_sort_threads;
 
   costs.compute_sort_costs(&param, rows_to_read, memory_available,
                            with_addon_fields);
@@ -46,9 +46,27 @@ double get_merge_many_buffs_cost_fast(ha_rows num_rows,
                                       ha_rows num_keys_per_buffer,
                                       size_t elem_size,
                                       double compare_cost,
-                                      bool with_addon_fields);
+                                      double disk_read_cost,
+                                      bool with_addon_fields,
+                                      uint sort_threads= 1);
 
 
+/* Minimum number of keys that a filesort thread sorts by itself */
+#define FILESORT_MIN_KEYS_PER_THREAD 16384
+
+/** Free the threads that sort filesort buffers, at server shutdown */
+void filesort_free_thread_pool();
+
+/**
+  Number of threads that sort a buffer of num_keys keys, with at most
+  max_threads threads (@see max_sort_threads).
+*/
+static inline uint filesort_sort_threads(ha_rows num_keys, uint max_threads)
+{
+  ha_rows parts= num_keys / FILESORT_MIN_KEYS_PER_THREAD;
+  return (uint) MY_MAX(1, MY_MIN(parts, (ha_rows) max_threads));
+}
+
 
 /**
   These are the current sorting algorithms we compute cost for:
@@ -148,8 +166,11 @@ class Filesort_buffer
     m_size_in_bytes(0), m_idx(0)
   {}
 
-  /** Sort me... */
-  void sort_buffer(const Sort_param *param, uint count);
+  /**
+    Sort me...
+    @return number of threads that took part in the sort
+  */
+  uint sort_buffer(const Sort_param *param, uint count);
 
   /**
     Reverses the record pointer array, to avoid recording new results for
@@ -26,6 +26,7 @@ class THD;
 int get_quote_char_for_identifier(THD *thd, const char *name, size_t length);
 bool schema_table_store_record(THD *thd, TABLE *table);
 void localtime_to_TIME(MYSQL_TIME *to, struct tm *from);
+bool thd_is_explain(const THD *thd);
 
 void sql_print_error(const char *format, ...);
 
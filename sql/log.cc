@@ -125,6 +125,15 @@ static ulonglong binlog_status_var_num_group_commits;
 static ulonglong binlog_status_group_commit_trigger_count;
 static ulonglong binlog_status_group_commit_trigger_lock_wait;
 static ulonglong binlog_status_group_commit_trigger_timeout;
+static ulonglong binlog_status_group_commit_write_time;
+static ulonglong binlog_status_group_commit_sync_time;
+static ulonglong binlog_status_group_commit_ordered_time;
+static ulonglong binlog_status_group_commit_write_hist
+  [MYSQL_BIN_LOG::GROUP_COMMIT_TIME_BUCKETS];
+static ulonglong binlog_status_group_commit_sync_hist
+  [MYSQL_BIN_LOG::GROUP_COMMIT_TIME_BUCKETS];
+static ulonglong binlog_status_group_commit_ordered_hist
+  [MYSQL_BIN_LOG::GROUP_COMMIT_TIME_BUCKETS];
 static char binlog_snapshot_file[FN_REFLEN];
 static ulonglong binlog_snapshot_position;
 
@@ -135,6 +144,22 @@ static const char *fatal_log_error=
   "restart it.";
 
 
+#define GROUP_COMMIT_TIME_HISTOGRAM(hist)                       \
+  {"under_100us", (char *) &hist[0], SHOW_LONGLONG},            \
+  {"under_1ms", (char *) &hist[1], SHOW_LONGLONG},              \
+  {"under_10ms", (char *) &hist[2], SHOW_LONGLONG},             \
+  {"under_100ms", (char *) &hist[3], SHOW_LONGLONG},            \
+  {"under_1s", (char *) &hist[4], SHOW_LONGLONG},               \
+  {"over_1s", (char *) &hist[5], SHOW_LONGLONG},                \
+  {NullS, NullS, SHOW_LONG}
+
+static SHOW_VAR binlog_status_group_commit_write_hist_vars[]=
+{ GROUP_COMMIT_TIME_HISTOGRAM(binlog_status_group_commit_write_hist) };
+static SHOW_VAR binlog_status_group_commit_sync_hist_vars[]=
+{ GROUP_COMMIT_TIME_HISTOGRAM(binlog_status_group_commit_sync_hist) };
+static SHOW_VAR binlog_status_group_commit_ordered_hist_vars[]=
+{ GROUP_COMMIT_TIME_HISTOGRAM(binlog_status_group_commit_ordered_hist) };
+
 static SHOW_VAR binlog_status_vars_detail[]=
 {
   {"commits",
@@ -147,6 +172,18 @@ static SHOW_VAR binlog_status_vars_detail[]=
     (char *)&binlog_status_group_commit_trigger_lock_wait, SHOW_LONGLONG},
   {"group_commit_trigger_timeout",
     (char *)&binlog_status_group_commit_trigger_timeout, SHOW_LONGLONG},
+  {"group_commit_write_time",
+    (char *)&binlog_status_group_commit_write_time, SHOW_LONGLONG},
+  {"group_commit_sync_time",
+    (char *)&binlog_status_group_commit_sync_time, SHOW_LONGLONG},
+  {"group_commit_ordered_time",
+    (char *)&binlog_status_group_commit_ordered_time, SHOW_LONGLONG},
+  {"group_commit_write_time",
+    (char *)binlog_status_group_commit_write_hist_vars, SHOW_ARRAY},
+  {"group_commit_sync_time",
+    (char *)binlog_status_group_commit_sync_hist_vars, SHOW_ARRAY},
+  {"group_commit_ordered_time",
+    (char *)binlog_status_group_commit_ordered_hist_vars, SHOW_ARRAY},
   {"snapshot_file",
     (char *)&binlog_snapshot_file, SHOW_CHAR},
   {"snapshot_position",
@@ -3652,6 +3689,10 @@ MYSQL_BIN_LOG::MYSQL_BIN_LOG(uint *sync_period)
    num_commits(0), num_group_commits(0),
    group_commit_trigger_count(0), group_commit_trigger_timeout(0),
    group_commit_trigger_lock_wait(0),
+   group_commit_write_time(0), group_commit_sync_time(0),
+   group_commit_ordered_time(0),
+   group_commit_write_hist(), group_commit_sync_hist(),
+   group_commit_ordered_hist(),
    sync_period_ptr(sync_period), sync_counter(0),
    state_file_deleted(false), binlog_state_recover_done(false),
    is_relay_log(0), relay_signal_cnt(0),
@@ -8794,6 +8835,20 @@ MYSQL_BIN_LOG::write_transaction_to_binlog_events(group_commit_entry *entry)
   return 1;
 }
 
+/**
+  @return the histogram bucket of a group commit stage time
+  @param us  the stage time in microseconds
+*/
+static uint group_commit_time_bucket(ulonglong us)
+{
+  uint bucket= 0;
+  for (ulonglong limit= 100;
+       bucket < MYSQL_BIN_LOG::GROUP_COMMIT_TIME_BUCKETS - 1 && us >= limit;
+       limit*= 10)
+    bucket++;
+  return bucket;
+}
+
 /*
   Do binlog group commit as the lead thread.
 
@@ -8814,6 +8869,8 @@ MYSQL_BIN_LOG::trx_group_commit_leader(group_commit_entry *leader)
   bool check_purge= false;
   ulong UNINIT_VAR(binlog_id);
   uint64 commit_id;
+  /* Start times of the group commit stages, for the status variables */
+  ulonglong write_start, sync_start= 0, sync_end= 0;
   DBUG_ENTER("MYSQL_BIN_LOG::trx_group_commit_leader");
 
   {
@@ -8842,6 +8899,7 @@ MYSQL_BIN_LOG::trx_group_commit_leader(group_commit_entry *leader)
     group_commit_queue= NULL;
     mysql_mutex_unlock(&LOCK_prepare_ordered);
     binlog_id= current_binlog_id;
+    write_start= microsecond_interval_timer();
 
     /* As the queue is in reverse order of entering, reverse it. */
     last_in_queue= current;
@@ -8929,7 +8987,10 @@ MYSQL_BIN_LOG::trx_group_commit_leader(group_commit_entry *leader)
     set_current_thd(leader->thd);
 
     bool synced= 0;
-    if (unlikely(flush_and_sync(&synced)))
+    sync_start= microsecond_interval_timer();
+    bool sync_failed= flush_and_sync(&synced);
+    sync_end= microsecond_interval_timer();
+    if (unlikely(sync_failed))
     {
       for (current= queue; current != NULL; current= current->next)
       {
@@ -9071,6 +9132,14 @@ MYSQL_BIN_LOG::trx_group_commit_leader(group_commit_entry *leader)
   mysql_mutex_unlock(&LOCK_after_binlog_sync);
   DEBUG_SYNC(leader->thd, "commit_after_release_LOCK_after_binlog_sync");
   ++num_group_commits;
+  if (sync_start)
+  {
+    group_commit_write_time+= sync_start - write_start;
+    group_commit_sync_time+= sync_end - sync_start;
+    group_commit_write_hist[group_commit_time_bucket(sync_start -
+                                                     write_start)]++;
+    group_commit_sync_hist[group_commit_time_bucket(sync_end - sync_start)]++;
+  }
 
   if (!opt_optimize_thread_scheduling)
   {
@@ -9103,6 +9172,7 @@ MYSQL_BIN_LOG::trx_group_commit_leader(group_commit_entry *leader)
     Wakeup each participant waiting for our group commit, first calling the
     commit_ordered() methods for any transactions doing 2-phase commit.
   */
+  const ulonglong ordered_start= microsecond_interval_timer();
   current= queue;
   while (current != NULL)
   {
@@ -9134,6 +9204,9 @@ MYSQL_BIN_LOG::trx_group_commit_leader(group_commit_entry *leader)
     current= next;
   }
   DEBUG_SYNC(leader->thd, "commit_after_group_run_commit_ordered");
+  const ulonglong ordered_time= microsecond_interval_timer() - ordered_start;
+  group_commit_ordered_time+= ordered_time;
+  group_commit_ordered_hist[group_commit_time_bucket(ordered_time)]++;
   mysql_mutex_unlock(&LOCK_commit_ordered);
   DEBUG_SYNC(leader->thd, "commit_after_group_release_commit_ordered");
 
@@ -12315,6 +12388,15 @@ TC_LOG_BINLOG::set_status_variables(THD *thd)
   mysql_mutex_lock(&LOCK_commit_ordered);
   binlog_status_var_num_commits= this->num_commits;
   binlog_status_var_num_group_commits= this->num_group_commits;
+  binlog_status_group_commit_write_time= this->group_commit_write_time;
+  binlog_status_group_commit_sync_time= this->group_commit_sync_time;
+  binlog_status_group_commit_ordered_time= this->group_commit_ordered_time;
+  memcpy(binlog_status_group_commit_write_hist, group_commit_write_hist,
+         sizeof group_commit_write_hist);
+  memcpy(binlog_status_group_commit_sync_hist, group_commit_sync_hist,
+         sizeof group_commit_sync_hist);
+  memcpy(binlog_status_group_commit_ordered_hist, group_commit_ordered_hist,
+         sizeof group_commit_ordered_hist);
   if (!have_snapshot)
   {
     set_binlog_snapshot_file(last_commit_pos_file);
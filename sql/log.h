@@ -707,6 +707,25 @@ class MYSQL_BIN_LOG: public TC_LOG, private Event_log
   /* The reason why the group commit was grouped */
   ulonglong group_commit_trigger_count, group_commit_trigger_timeout;
   ulonglong group_commit_trigger_lock_wait;
+  /*
+    Total time in microseconds spent by group commit leaders in each stage:
+    writing the transactions to the binlog, flushing and syncing the binlog,
+    and running commit_ordered() in the storage engines.
+    Protected by LOCK_commit_ordered.
+  */
+  ulonglong group_commit_write_time, group_commit_sync_time;
+  ulonglong group_commit_ordered_time;
+public:
+  /*
+    Number of histogram buckets of the group commit stage times:
+    under 100us, 1ms, 10ms, 100ms, 1s, and 1s or more
+  */
+  static constexpr uint GROUP_COMMIT_TIME_BUCKETS= 6;
+private:
+  /* Histograms of the stage times. Protected by LOCK_commit_ordered. */
+  ulonglong group_commit_write_hist[GROUP_COMMIT_TIME_BUCKETS];
+  ulonglong group_commit_sync_hist[GROUP_COMMIT_TIME_BUCKETS];
+  ulonglong group_commit_ordered_hist[GROUP_COMMIT_TIME_BUCKETS];
 
   /* pointer to the sync period variable, for binlog this will be
      sync_binlog_period, for relay log this will be
@@ -30,6 +30,7 @@
 #include <mysql/psi/mysql_mdl.h>
 #include <algorithm>
 #include <array>
+#include "aligned.h"
 #ifdef WITH_WSREP
 #include "wsrep_mysqld.h"
 #endif
@@ -38,10 +39,12 @@ static PSI_memory_key key_memory_MDL_context_acquire_locks;
 
 #ifdef HAVE_PSI_INTERFACE
 static PSI_mutex_key key_MDL_wait_LOCK_wait_status;
+static PSI_mutex_key key_MDL_lock_fast_path_mutex;
 
 static PSI_mutex_info all_mdl_mutexes[]=
 {
-  { &key_MDL_wait_LOCK_wait_status, "MDL_wait::LOCK_wait_status", 0}
+  { &key_MDL_wait_LOCK_wait_status, "MDL_wait::LOCK_wait_status", 0},
+  { &key_MDL_lock_fast_path_mutex, "MDL_lock::fast_path_mutex", 0}
 };
 
 static PSI_rwlock_key key_MDL_lock_rwlock;
@@ -173,7 +176,8 @@ class MDL_map
 public:
   void init();
   void destroy();
-  MDL_lock *find_or_insert(LF_PINS *pins, const MDL_key *key);
+  MDL_lock *find_or_insert(LF_PINS *pins, const MDL_key *key,
+                           MDL_ticket *fast_path_ticket);
   unsigned long get_lock_owner(LF_PINS *pins, const MDL_key *key);
   void remove(LF_PINS *pins, MDL_lock *lock);
   LF_PINS *get_pins() { return lf_hash_get_pins(&m_locks); }
@@ -415,6 +419,15 @@ class MDL_lock
     virtual bool needs_notification(const MDL_ticket *ticket) const = 0;
     virtual bool conflicting_locks(const MDL_ticket *ticket) const = 0;
     virtual bitmap_t hog_lock_types_bitmap() const = 0;
+    /**
+      Lock types which may be granted through the fast path (unobtrusive
+      locks). They must be compatible with each other and with all types
+      except those in obtrusive_types_bitmap(), both when granted and
+      when waiting.
+    */
+    virtual bitmap_t fast_path_types_bitmap() const = 0;
+    /** Lock types which conflict with some of fast_path_types_bitmap() */
+    virtual bitmap_t obtrusive_types_bitmap() const = 0;
     virtual ~MDL_lock_strategy() = default;
   };
 
@@ -451,6 +464,12 @@ class MDL_lock
     */
     virtual bitmap_t hog_lock_types_bitmap() const
     { return 0; }
+
+    /* Scoped locks are rarely taken, they never use the fast path. */
+    virtual bitmap_t fast_path_types_bitmap() const
+    { return 0; }
+    virtual bitmap_t obtrusive_types_bitmap() const
+    { return 0; }
   private:
     static const bitmap_t m_granted_incompatible[MDL_TYPE_END];
     static const bitmap_t m_waiting_incompatible[MDL_TYPE_END];
@@ -499,6 +518,20 @@ class MDL_lock
               MDL_BIT(MDL_EXCLUSIVE));
     }
 
+    /* Locks taken by DML statements */
+    virtual bitmap_t fast_path_types_bitmap() const
+    {
+      return (MDL_BIT(MDL_SHARED) | MDL_BIT(MDL_SHARED_HIGH_PRIO) |
+              MDL_BIT(MDL_SHARED_READ) | MDL_BIT(MDL_SHARED_WRITE));
+    }
+    virtual bitmap_t obtrusive_types_bitmap() const
+    {
+      return (MDL_BIT(MDL_SHARED_READ_ONLY) |
+              MDL_BIT(MDL_SHARED_NO_WRITE) |
+              MDL_BIT(MDL_SHARED_NO_READ_WRITE) |
+              MDL_BIT(MDL_EXCLUSIVE));
+    }
+
   private:
     static const bitmap_t m_granted_incompatible[MDL_TYPE_END];
     static const bitmap_t m_waiting_incompatible[MDL_TYPE_END];
@@ -536,6 +569,19 @@ class MDL_lock
     */
     virtual bitmap_t hog_lock_types_bitmap() const
     { return 0; }
+
+    /* Locks taken by every statement changing data, and by commit */
+    virtual bitmap_t fast_path_types_bitmap() const
+    {
+      return (MDL_BIT(MDL_BACKUP_DML) | MDL_BIT(MDL_BACKUP_TRANS_DML) |
+              MDL_BIT(MDL_BACKUP_SYS_DML) | MDL_BIT(MDL_BACKUP_COMMIT));
+    }
+    virtual bitmap_t obtrusive_types_bitmap() const
+    {
+      return (MDL_BIT(MDL_BACKUP_FLUSH) | MDL_BIT(MDL_BACKUP_WAIT_FLUSH) |
+              MDL_BIT(MDL_BACKUP_WAIT_DDL) | MDL_BIT(MDL_BACKUP_WAIT_COMMIT) |
+              MDL_BIT(MDL_BACKUP_FTWRL1) | MDL_BIT(MDL_BACKUP_FTWRL2));
+    }
   private:
     static const bitmap_t m_granted_incompatible[MDL_BACKUP_END];
     static const bitmap_t m_waiting_incompatible[MDL_BACKUP_END];
@@ -594,7 +640,7 @@ class MDL_lock
   bool can_grant_lock(enum_mdl_type type, MDL_context *requstor_ctx,
                       bool ignore_lock_priority) const;
 
-  inline unsigned long get_lock_owner() const;
+  inline unsigned long get_lock_owner();
 
   void reschedule_waiters();
 
@@ -640,16 +686,73 @@ class MDL_lock
   */
   ulong m_hog_lock_count;
 
+  /** Number of fast path shards in each MDL_lock */
+  static constexpr uint FAST_PATH_SHARDS= 8;
+
+  /**
+    Unobtrusive locks (see MDL_lock_strategy::fast_path_types_bitmap())
+    granted without acquiring m_rwlock. Each context uses one shard, so
+    that DML on a hot object does not serialize on m_rwlock.
+
+    The fast path is enabled when an unobtrusive lock is granted while
+    the object is already locked, and disabled when an obtrusive lock is
+    requested. Disabling moves all tickets of the shards to m_granted.
+    Thus the code which has to see conflicting tickets (can_grant_lock(),
+    visit_subgraph(), notify_conflicting_locks()) only needs to look at
+    m_granted, and the shards are empty while the fast path is disabled.
+
+    The shards are allocated when the fast path is enabled for the first
+    time, so that objects that are never contended do not pay for them.
+  */
+  struct alignas(CPU_LEVEL1_DCACHE_LINESIZE) Fast_path_shard
+  {
+    /** protects m_tickets and MDL_ticket::m_fast_path */
+    mysql_mutex_t m_mutex;
+    /** tickets with MDL_ticket::m_fast_path set */
+    ilist<MDL_ticket> m_tickets;
+  };
+  typedef std::array<Fast_path_shard, FAST_PATH_SHARDS> Fast_path_shards;
+  /**
+    The fast path shards, or nullptr if the fast path was never enabled.
+    Assigned once while holding exclusive m_rwlock, before
+    m_fast_path_enabled is set for the first time, and freed in the
+    destructor.
+  */
+  Fast_path_shards *m_fast_path;
+  /**
+    Whether the fast path may be used. Modified while holding exclusive
+    m_rwlock and read under m_rwlock or a shard mutex.
+  */
+  std::atomic<bool> m_fast_path_enabled;
+
+  bool is_fast_path_enabled() const
+  { return m_fast_path_enabled.load(std::memory_order_acquire); }
+  Fast_path_shard &fast_path_shard(const MDL_ticket *ticket)
+  { return (*m_fast_path)[ticket->get_ctx()->get_fast_path_shard()]; }
+
+  bool fast_path_grant(MDL_ticket *ticket);
+  bool fast_path_release(MDL_ticket *ticket);
+  void enable_fast_path(enum_mdl_type type);
+  void disable_fast_path(enum_mdl_type type);
+  bool remove_fast_path_ticket(MDL_ticket *ticket);
+  void materialize_fast_path_ticket(MDL_ticket *ticket);
+
 public:
 
   MDL_lock()
     : m_hog_lock_count(0),
+      m_fast_path(nullptr),
+      m_fast_path_enabled(false),
       m_strategy(0)
-  { mysql_prlock_init(key_MDL_lock_rwlock, &m_rwlock); }
+  {
+    mysql_prlock_init(key_MDL_lock_rwlock, &m_rwlock);
+  }
 
   MDL_lock(const MDL_key *key_arg)
   : key(key_arg),
     m_hog_lock_count(0),
+    m_fast_path(nullptr),
+    m_fast_path_enabled(false),
     m_strategy(&m_backup_lock_strategy)
   {
     DBUG_ASSERT(key_arg->mdl_namespace() == MDL_key::BACKUP);
@@ -657,7 +760,19 @@ class MDL_lock
   }
 
   ~MDL_lock()
-  { mysql_prlock_destroy(&m_rwlock); }
+  {
+    if (m_fast_path)
+    {
+      for (Fast_path_shard &shard : *m_fast_path)
+      {
+        DBUG_ASSERT(shard.m_tickets.empty());
+        mysql_mutex_destroy(&shard.m_mutex);
+      }
+      m_fast_path->~Fast_path_shards();
+      aligned_free(m_fast_path);
+    }
+    mysql_prlock_destroy(&m_rwlock);
+  }
 
   static void lf_alloc_constructor(uchar *arg)
   { new (arg + LF_HASH_OVERHEAD) MDL_lock(); }
@@ -670,10 +785,21 @@ class MDL_lock
   {
     DBUG_ASSERT(key_arg->mdl_namespace() != MDL_key::BACKUP);
     new (&lock->key) MDL_key(key_arg);
-    if (key_arg->mdl_namespace() == MDL_key::SCHEMA)
-      lock->m_strategy= &m_scoped_lock_strategy;
-    else
-      lock->m_strategy= &m_object_lock_strategy;
+    lock->m_fast_path_enabled.store(false, std::memory_order_relaxed);
+    lock->m_strategy= get_strategy(key_arg->mdl_namespace());
+  }
+
+  static const MDL_lock_strategy *
+  get_strategy(MDL_key::enum_mdl_namespace mdl_namespace)
+  {
+    switch (mdl_namespace) {
+    case MDL_key::BACKUP:
+      return &m_backup_lock_strategy;
+    case MDL_key::SCHEMA:
+      return &m_scoped_lock_strategy;
+    default:
+      return &m_object_lock_strategy;
+    }
   }
 
   const MDL_lock_strategy *m_strategy;
@@ -764,6 +890,18 @@ static my_bool mdl_iterate_lock(MDL_lock *lock, mdl_iterate_arg *arg)
                         [arg](MDL_ticket &ticket) {
                           return arg->callback(&ticket, arg->argument, true);
                         });
+  if (lock->is_fast_path_enabled())
+  {
+    for (MDL_lock::Fast_path_shard &shard : *lock->m_fast_path)
+    {
+      mysql_mutex_lock(&shard.m_mutex);
+      res|= std::any_of(shard.m_tickets.begin(), shard.m_tickets.end(),
+                        [arg](MDL_ticket &ticket) {
+                          return arg->callback(&ticket, arg->argument, true);
+                        });
+      mysql_mutex_unlock(&shard.m_mutex);
+    }
+  }
   res= std::any_of(lock->m_waiting.begin(), lock->m_waiting.end(),
                    [arg](MDL_ticket &ticket) {
                      return arg->callback(&ticket, arg->argument, false);
@@ -834,12 +972,17 @@ void MDL_map::destroy()
   Find MDL_lock object corresponding to the key, create it
   if it does not exist.
 
+  @param fast_path_ticket  ticket to try to grant through the fast path,
+                           or NULL
+
   @retval non-NULL - Success. MDL_lock instance for the key with
-                     locked MDL_lock::m_rwlock.
+                     locked MDL_lock::m_rwlock, or without it if
+                     fast_path_ticket was granted (its get_lock() is set).
   @retval NULL     - Failure (OOM).
 */
 
-MDL_lock* MDL_map::find_or_insert(LF_PINS *pins, const MDL_key *mdl_key)
+MDL_lock* MDL_map::find_or_insert(LF_PINS *pins, const MDL_key *mdl_key,
+                                  MDL_ticket *fast_path_ticket)
 {
   MDL_lock *lock;
 
@@ -853,6 +996,8 @@ MDL_lock* MDL_map::find_or_insert(LF_PINS *pins, const MDL_key *mdl_key)
       for them look like '<namespace-id>\0\0'.
     */
     DBUG_ASSERT(mdl_key->length() == 3);
+    if (fast_path_ticket && m_backup_lock->fast_path_grant(fast_path_ticket))
+      return m_backup_lock;
     mysql_prlock_wrlock(&m_backup_lock->m_rwlock);
     return m_backup_lock;
   }
@@ -863,6 +1008,12 @@ MDL_lock* MDL_map::find_or_insert(LF_PINS *pins, const MDL_key *mdl_key)
     if (lf_hash_insert(&m_locks, pins, (uchar*) mdl_key) == -1)
       return NULL;
 
+  if (fast_path_ticket && lock->fast_path_grant(fast_path_ticket))
+  {
+    lf_hash_search_unpin(pins);
+    return lock;
+  }
+
   mysql_prlock_wrlock(&lock->m_rwlock);
   if (unlikely(!lock->m_strategy))
   {
@@ -926,9 +1077,32 @@ void MDL_map::remove(LF_PINS *pins, MDL_lock *lock)
     return;
   }
 
-  lock->m_strategy= 0;
+  /*
+    Tickets may have been granted through the fast path after
+    MDL_lock::is_empty() was checked. MDL_lock::fast_path_grant()
+    checks m_strategy under a shard mutex.
+  */
+  bool empty= true;
+  uint locked= 0;
+  while (lock->is_fast_path_enabled() && locked < MDL_lock::FAST_PATH_SHARDS)
+  {
+    MDL_lock::Fast_path_shard &shard= (*lock->m_fast_path)[locked++];
+    mysql_mutex_lock(&shard.m_mutex);
+    if (!shard.m_tickets.empty())
+    {
+      empty= false;
+      break;
+    }
+  }
+
+  if (empty)
+    lock->m_strategy= 0;
+  while (locked)
+    mysql_mutex_unlock(&(*lock->m_fast_path)[--locked].m_mutex);
   mysql_prlock_unlock(&lock->m_rwlock);
-  lf_hash_delete(&m_locks, pins, lock->key.ptr(), lock->key.length());
+
+  if (empty)
+    lf_hash_delete(&m_locks, pins, lock->key.ptr(), lock->key.length());
 }
 
 
@@ -945,6 +1119,10 @@ MDL_context::MDL_context()
   m_waiting_for(NULL),
   m_pins(NULL)
 {
+  static std::atomic<uint> next_fast_path_shard;
+  m_fast_path_shard=
+    next_fast_path_shard.fetch_add(1, std::memory_order_relaxed) %
+    MDL_lock::FAST_PATH_SHARDS;
   mysql_prlock_init(key_MDL_context_LOCK_waiting_for, &m_LOCK_waiting_for);
 }
 
@@ -1814,12 +1992,196 @@ MDL_lock::can_grant_lock(enum_mdl_type type_arg,
 */
 
 inline unsigned long
-MDL_lock::get_lock_owner() const
+MDL_lock::get_lock_owner()
 {
-  if (m_granted.is_empty())
-    return 0;
+  if (!m_granted.is_empty())
+    return m_granted.begin()->get_ctx()->get_thread_id();
+
+  if (is_fast_path_enabled())
+  {
+    for (Fast_path_shard &shard : *m_fast_path)
+    {
+      unsigned long res= 0;
+      mysql_mutex_lock(&shard.m_mutex);
+      if (!shard.m_tickets.empty())
+        res= shard.m_tickets.front().get_ctx()->get_thread_id();
+      mysql_mutex_unlock(&shard.m_mutex);
+      if (res)
+        return res;
+    }
+  }
+  return 0;
+}
+
+
+/**
+  Grant a lock through the fast path, without acquiring m_rwlock.
+
+  @param ticket  ticket of a type in fast_path_types_bitmap()
+
+  @return whether the lock was granted
+  @retval false  the fast path is disabled or the object is being removed
+*/
+
+bool MDL_lock::fast_path_grant(MDL_ticket *ticket)
+{
+  if (!is_fast_path_enabled())
+    return false;
+  Fast_path_shard &shard= fast_path_shard(ticket);
+  mysql_mutex_lock(&shard.m_mutex);
+  /* MDL_map::remove() resets m_strategy while holding all shard mutexes */
+  const bool granted= is_fast_path_enabled() && m_strategy;
+  if (granted)
+  {
+    DBUG_ASSERT(MDL_BIT(ticket->get_type()) &
+                m_strategy->fast_path_types_bitmap());
+    ticket->m_lock= this;
+    ticket->m_fast_path= true;
+    shard.m_tickets.push_back(*ticket);
+  }
+  mysql_mutex_unlock(&shard.m_mutex);
+  return granted;
+}
+
+
+/**
+  Release a lock that was granted through the fast path, without
+  acquiring m_rwlock.
+
+  No waiters need to be woken up: any conflicting request would have
+  disabled the fast path and moved the ticket to m_granted. We only
+  proceed if other tickets in the shard keep this object from being
+  removed, because the last one must check if the object is unused.
+
+  @return whether the ticket was released
+  @retval false  remove_ticket() must be invoked
+*/
+
+bool MDL_lock::fast_path_release(MDL_ticket *ticket)
+{
+  /*
+    If the fast path was disabled concurrently, remove_ticket() will wait
+    for disable_fast_path() to move the ticket to m_granted.
+  */
+  if (!is_fast_path_enabled())
+    return false;
+  Fast_path_shard &shard= fast_path_shard(ticket);
+  mysql_mutex_lock(&shard.m_mutex);
+  const bool released= ticket->m_fast_path &&
+    (&shard.m_tickets.front() != &shard.m_tickets.back() ||
+     key.mdl_namespace() == MDL_key::BACKUP);
+  if (released)
+  {
+    shard.m_tickets.remove(*ticket);
+    ticket->m_fast_path= false;
+  }
+  mysql_mutex_unlock(&shard.m_mutex);
+  return released;
+}
+
+
+/**
+  Enable the fast path when an unobtrusive lock is being granted to an
+  object that is already locked by others. Uncontended objects keep using
+  m_granted only, so that MDL_map::remove() need not check the shards.
+
+  @param type  the type of the lock that is being granted
+  @pre m_rwlock is write-locked
+*/
+
+void MDL_lock::enable_fast_path(enum_mdl_type type)
+{
+  mysql_prlock_assert_write_owner(&m_rwlock);
+  if (MDL_BIT(type) & m_strategy->fast_path_types_bitmap() &&
+      !is_fast_path_enabled() && !m_granted.is_empty() &&
+      !((m_granted.bitmap() | m_waiting.bitmap()) &
+        m_strategy->obtrusive_types_bitmap()))
+  {
+    if (!m_fast_path)
+    {
+      void *shards= aligned_malloc(sizeof(Fast_path_shards),
+                                   alignof(Fast_path_shards));
+      if (!shards)
+        return;
+      m_fast_path= new (shards) Fast_path_shards();
+      for (Fast_path_shard &shard : *m_fast_path)
+        mysql_mutex_init(key_MDL_lock_fast_path_mutex, &shard.m_mutex,
+                         MY_MUTEX_INIT_FAST);
+    }
+    m_fast_path_enabled.store(true, std::memory_order_release);
+  }
+}
+
+
+/**
+  Disable the fast path before an obtrusive lock is granted or waited for,
+  and move all tickets that were granted through it to m_granted.
+
+  @param type  the type of the lock that is being requested
+  @pre m_rwlock is write-locked
+*/
+
+void MDL_lock::disable_fast_path(enum_mdl_type type)
+{
+  mysql_prlock_assert_write_owner(&m_rwlock);
+  if (!is_fast_path_enabled() ||
+      !(MDL_BIT(type) & m_strategy->obtrusive_types_bitmap()))
+    return;
+  m_fast_path_enabled.store(false, std::memory_order_relaxed);
+
+  for (Fast_path_shard &shard : *m_fast_path)
+  {
+    mysql_mutex_lock(&shard.m_mutex);
+    while (!shard.m_tickets.empty())
+    {
+      MDL_ticket &ticket= shard.m_tickets.front();
+      shard.m_tickets.pop_front();
+      ticket.m_fast_path= false;
+      m_granted.add_ticket(&ticket);
+    }
+    mysql_mutex_unlock(&shard.m_mutex);
+  }
+}
+
+
+/**
+  Remove a ticket from its fast path shard.
+
+  @pre m_rwlock is write-locked
+  @return whether the ticket was granted through the fast path
+*/
 
-  return m_granted.begin()->get_ctx()->get_thread_id();
+bool MDL_lock::remove_fast_path_ticket(MDL_ticket *ticket)
+{
+  mysql_prlock_assert_write_owner(&m_rwlock);
+  if (!is_fast_path_enabled())
+  {
+    DBUG_ASSERT(!ticket->m_fast_path);
+    return false;
+  }
+  Fast_path_shard &shard= fast_path_shard(ticket);
+  mysql_mutex_lock(&shard.m_mutex);
+  const bool fast_path= ticket->m_fast_path;
+  if (fast_path)
+  {
+    shard.m_tickets.remove(*ticket);
+    ticket->m_fast_path= false;
+  }
+  mysql_mutex_unlock(&shard.m_mutex);
+  return fast_path;
+}
+
+
+/**
+  Move a ticket that was granted through the fast path to m_granted.
+
+  @pre m_rwlock is write-locked
+*/
+
+void MDL_lock::materialize_fast_path_ticket(MDL_ticket *ticket)
+{
+  if (remove_fast_path_ticket(ticket))
+    m_granted.add_ticket(ticket);
 }
 
 
@@ -1829,7 +2191,8 @@ void MDL_lock::remove_ticket(LF_PINS *pins, Ticket_list MDL_lock::*list,
                              MDL_ticket *ticket)
 {
   mysql_prlock_wrlock(&m_rwlock);
-  (this->*list).remove_ticket(ticket);
+  if (list != &MDL_lock::m_granted || !remove_fast_path_ticket(ticket))
+    (this->*list).remove_ticket(ticket);
   if (is_empty())
     mdl_locks.remove(pins, this);
   else
@@ -2107,13 +2470,38 @@ MDL_context::try_acquire_lock_impl(MDL_request *mdl_request,
                                    )))
     return TRUE;
 
-  /* The below call implicitly locks MDL_lock::m_rwlock on success. */
-  if (!(lock= mdl_locks.find_or_insert(m_pins, key)))
+  MDL_ticket *fast_path_ticket=
+    MDL_BIT(mdl_request->type) &
+    MDL_lock::get_strategy(key->mdl_namespace())->fast_path_types_bitmap()
+    ? ticket : NULL;
+
+  /*
+    The below call implicitly locks MDL_lock::m_rwlock on success,
+    unless the lock was granted through the fast path.
+  */
+  if (!(lock= mdl_locks.find_or_insert(m_pins, key, fast_path_ticket)))
   {
     MDL_ticket::destroy(ticket);
     return TRUE;
   }
 
+  if (ticket->m_lock)
+  {
+    DBUG_ASSERT(ticket->m_psi == NULL);
+    ticket->m_psi= mysql_mdl_create(ticket,
+                                    &mdl_request->key,
+                                    mdl_request->type,
+                                    mdl_request->duration,
+                                    MDL_ticket::GRANTED,
+                                    mdl_request->m_src_file,
+                                    mdl_request->m_src_line);
+    m_tickets[mdl_request->duration].push_front(ticket);
+    mdl_request->ticket= ticket;
+    return FALSE;
+  }
+
+  lock->disable_fast_path(mdl_request->type);
+
   DBUG_ASSERT(ticket->m_psi == NULL);
   ticket->m_psi= mysql_mdl_create(ticket,
                                   &mdl_request->key,
@@ -2127,6 +2515,7 @@ MDL_context::try_acquire_lock_impl(MDL_request *mdl_request,
 
   if (lock->can_grant_lock(mdl_request->type, this, false))
   {
+    lock->enable_fast_path(mdl_request->type);
     lock->m_granted.add_ticket(ticket);
 
     mysql_prlock_unlock(&lock->m_rwlock);
@@ -2614,8 +3003,13 @@ MDL_context::upgrade_shared_lock(MDL_ticket *mdl_ticket,
 
   /* Merge the acquired and the original lock. @todo: move to a method. */
   mysql_prlock_wrlock(&mdl_ticket->m_lock->m_rwlock);
+  mdl_ticket->m_lock->materialize_fast_path_ticket(mdl_ticket);
   if (is_new_ticket)
+  {
+    /* Upgrades are to types outside fast_path_types_bitmap(). */
+    DBUG_ASSERT(!mdl_xlock_request.ticket->m_fast_path);
     mdl_ticket->m_lock->m_granted.remove_ticket(mdl_xlock_request.ticket);
+  }
   /*
     Set the new type of lock in the ticket. To update state of
     MDL_lock object correctly we need to temporarily exclude
@@ -2896,7 +3290,8 @@ void MDL_context::release_lock(enum_mdl_duration duration, MDL_ticket *ticket)
   DBUG_ASSERT(this == ticket->get_ctx());
   DBUG_PRINT("mdl", ("Released: %s", dbug_print_mdl(ticket)));
 
-  lock->remove_ticket(m_pins, &MDL_lock::m_granted, ticket);
+  if (!lock->fast_path_release(ticket))
+    lock->remove_ticket(m_pins, &MDL_lock::m_granted, ticket);
 
   m_tickets[duration].remove(ticket);
   MDL_ticket::destroy(ticket);
@@ -737,6 +737,7 @@ class MDL_ticket : public MDL_wait_for_subgraph, public ilist_node<>
                          PRE_ACQUIRE_NOTIFY, POST_RELEASE_NOTIFY };
 private:
   friend class MDL_context;
+  friend class MDL_lock;
 
   MDL_ticket(MDL_context *ctx_arg, enum_mdl_type type_arg
 #ifndef DBUG_OFF
@@ -749,7 +750,8 @@ class MDL_ticket : public MDL_wait_for_subgraph, public ilist_node<>
 #endif
      m_ctx(ctx_arg),
      m_lock(NULL),
-     m_psi(NULL)
+     m_psi(NULL),
+     m_fast_path(false)
   {}
 
   virtual ~MDL_ticket()
@@ -785,6 +787,13 @@ class MDL_ticket : public MDL_wait_for_subgraph, public ilist_node<>
 
   PSI_metadata_lock *m_psi;
 
+  /**
+    TRUE if the ticket was granted through the fast path and is kept in
+    the MDL_lock fast path shard of its context instead of
+    MDL_lock::m_granted. Protected by the mutex of that shard.
+  */
+  bool m_fast_path;
+
 private:
   MDL_ticket(const MDL_ticket &);               /* not implemented */
   MDL_ticket &operator=(const MDL_ticket &);    /* not implemented */
@@ -963,6 +972,7 @@ class MDL_context
   {
     return m_needs_thr_lock_abort;
   }
+  uint get_fast_path_shard() const { return m_fast_path_shard; }
 public:
   /**
     If our request for a lock is scheduled, or aborted by the deadlock
@@ -1055,6 +1065,12 @@ class MDL_context
   MDL_wait_for_subgraph *m_waiting_for;
   LF_PINS *m_pins;
   uint m_deadlock_overweight= 0;
+  /**
+    Index of the MDL_lock fast path shard used by this context.
+    Contexts are spread over the shards so that concurrent connections
+    acquiring shared locks on the same object use different mutexes.
+  */
+  uint m_fast_path_shard;
 private:
   MDL_ticket *find_ticket(MDL_request *mdl_req,
                           enum_mdl_duration *duration);
@@ -2002,6 +2002,7 @@ static void clean_up(bool print_message)
   query_cache_destroy();
   hostname_cache_free();
   item_func_sleep_free();
+  filesort_free_thread_pool();
   lex_free();				/* Free some memory */
   item_create_cleanup();
   cleanup_json_schema_keyword_hash();
@@ -7398,6 +7399,15 @@ static int show_threadpool_threads(THD *thd, SHOW_VAR *var, char *buff,
   *(reinterpret_cast<int*>(buff))= tp_get_thread_count();
   return 0;
 }
+
+
+static int show_threadpool_poll_backend(THD *thd, SHOW_VAR *var, char *buff,
+                                        enum enum_var_type scope)
+{
+  var->type= SHOW_CHAR;
+  var->value= const_cast<char*>(tp_get_poll_backend());
+  return 0;
+}
 #endif
 
 
@@ -7636,6 +7646,7 @@ SHOW_VAR status_vars[]= {
 #endif
 #ifdef HAVE_POOL_OF_THREADS
   {"Threadpool_idle_threads",  (char *) &show_threadpool_idle_threads, SHOW_SIMPLE_FUNC},
+  {"Threadpool_poll_backend",  (char *) &show_threadpool_poll_backend, SHOW_SIMPLE_FUNC},
   {"Threadpool_threads",       (char *) &show_threadpool_threads, SHOW_SIMPLE_FUNC},
 #endif
   {"Threads_cached",           (char*) &show_cached_thread_count, SHOW_SIMPLE_FUNC},
@@ -274,6 +274,7 @@ class Filesort_tracker : public Sql_alloc
     r_examined_rows(0), r_sorted_rows(0), r_output_rows(0),
     sort_passes(0),
     sort_buffer_size(0),
+    r_sort_threads(0),
     r_using_addons(false),
     r_packed_addon_fields(false),
     r_sort_keys_packed(false)
@@ -319,6 +320,11 @@ class Filesort_tracker : public Sql_alloc
       sort_buffer_size= bufsize;
   }
 
+  inline void report_sort_threads(uint threads)
+  {
+    set_if_bigger(r_sort_threads, threads);
+  }
+
   inline void report_addon_fields_format(bool addons_packed)
   {
     r_using_addons= true;
@@ -391,6 +397,8 @@ class Filesort_tracker : public Sql_alloc
     other          - value
   */
   ulonglong sort_buffer_size;
+  /* Largest number of threads that sorted one sort buffer */
+  uint r_sort_threads;
   bool r_using_addons;
   bool r_packed_addon_fields;
   bool r_sort_keys_packed;
@@ -278,6 +278,9 @@ The query cache interfaces with the rest of the server code through 7
          If a match is found the cached result set is sent through repeated
          calls to net_real_write. (note: calling thread does not have a
          registered result set writer: thd->net.query_cache_query=0)
+         Lookups only acquire a shared lock (try_lock_shared()), so that
+         any number of them can proceed concurrently. All other
+         operations acquire an exclusive lock.
  2. Query_cache::store_query
        - Called just before handle_select() and is used to register a result
          set writer to the statement currently being processed
@@ -617,7 +620,7 @@ bool Query_cache::try_lock(THD *thd, Cache_try_lock_mode mode)
 
   while (1)
   {
-    if (m_cache_lock_status == Query_cache::UNLOCKED)
+    if (m_cache_lock_status == Query_cache::UNLOCKED && !m_cache_readers)
     {
       m_cache_lock_status= Query_cache::LOCKED;
 #ifndef DBUG_OFF
@@ -636,21 +639,26 @@ bool Query_cache::try_lock(THD *thd, Cache_try_lock_mode mode)
     }
     else
     {
-      DBUG_ASSERT(m_cache_lock_status == Query_cache::LOCKED);
+      DBUG_ASSERT(m_cache_lock_status == Query_cache::LOCKED ||
+                  m_cache_readers);
       /*
         To prevent send_result_to_client() and query_cache_insert() from
         blocking execution for too long a timeout is put on the lock.
       */
       if (mode == WAIT)
       {
+        m_cache_writers_waiting++;
         mysql_cond_wait(&COND_cache_status_changed, &structure_guard_mutex);
+        m_cache_writers_waiting--;
       }
       else if (mode == TIMEOUT)
       {
         struct timespec waittime;
         set_timespec_nsec(waittime,50000000UL);  /* Wait for 50 msec */
+        m_cache_writers_waiting++;
         int res= mysql_cond_timedwait(&COND_cache_status_changed,
                                       &structure_guard_mutex, &waittime);
+        m_cache_writers_waiting--;
         if (res == ETIMEDOUT)
           break;
       }
@@ -694,8 +702,10 @@ void Query_cache::lock_and_suspend(void)
 
   mysql_mutex_lock(&structure_guard_mutex);
   m_requests_in_progress++;
-  while (m_cache_lock_status != Query_cache::UNLOCKED)
+  m_cache_writers_waiting++;
+  while (m_cache_lock_status != Query_cache::UNLOCKED || m_cache_readers)
     mysql_cond_wait(&COND_cache_status_changed, &structure_guard_mutex);
+  m_cache_writers_waiting--;
   m_cache_lock_status= Query_cache::LOCKED_NO_WAIT;
 #ifndef DBUG_OFF
   /* Here thd may not be set during shutdown */
@@ -725,8 +735,10 @@ void Query_cache::lock(THD *thd)
   mysql_mutex_lock(&structure_guard_mutex);
   m_requests_in_progress++;
   fix_local_query_cache_mode(thd);
-  while (m_cache_lock_status != Query_cache::UNLOCKED)
+  m_cache_writers_waiting++;
+  while (m_cache_lock_status != Query_cache::UNLOCKED || m_cache_readers)
     mysql_cond_wait(&COND_cache_status_changed, &structure_guard_mutex);
+  m_cache_writers_waiting--;
   m_cache_lock_status= Query_cache::LOCKED;
 #ifndef DBUG_OFF
   m_cache_lock_thread_id= thd->thread_id;
@@ -755,7 +767,102 @@ void Query_cache::unlock(void)
               m_cache_lock_status == Query_cache::LOCKED_NO_WAIT);
   m_cache_lock_status= Query_cache::UNLOCKED;
   DBUG_PRINT("Query_cache",("Sending signal"));
-  mysql_cond_signal(&COND_cache_status_changed);
+  /* Wake up all waiting try_lock_shared() and one of lock() or try_lock() */
+  mysql_cond_broadcast(&COND_cache_status_changed);
+  DBUG_ASSERT(m_requests_in_progress > 0);
+  m_requests_in_progress--;
+  if (m_requests_in_progress == 0 && m_cache_status == DISABLE_REQUEST)
+  {
+    /* No clients => just free query cache */
+    free_cache();
+    m_cache_status= DISABLED;
+  }
+  mysql_mutex_unlock(&structure_guard_mutex);
+  DBUG_VOID_RETURN;
+}
+
+
+/**
+  Acquire shared access to the query cache for looking up a query.
+
+  Any number of threads may hold the cache by try_lock_shared() at the
+  same time. They may search the hashes and read query and table
+  blocks, but they must not modify any shared structure, except
+  by unlock_shared(). Like try_lock(TIMEOUT), the attempt will fail
+  after a timeout or if lock_and_suspend() is in effect. To avoid
+  starvation of lock() and try_lock(), new readers will wait while
+  one of them is waiting.
+
+  @return
+   @retval FALSE A shared lock was taken
+   @retval TRUE The locking attempt failed
+*/
+
+bool Query_cache::try_lock_shared(THD *thd)
+{
+  bool interrupt= TRUE;
+  Query_cache_wait_state wait_state(thd, __func__, __FILE__, __LINE__);
+  DBUG_ENTER("Query_cache::try_lock_shared");
+
+  mysql_mutex_lock(&structure_guard_mutex);
+  if (m_cache_status == DISABLED)
+  {
+    mysql_mutex_unlock(&structure_guard_mutex);
+    DBUG_RETURN(TRUE);
+  }
+  m_requests_in_progress++;
+  fix_local_query_cache_mode(thd);
+
+  while (1)
+  {
+    if (m_cache_lock_status == Query_cache::UNLOCKED &&
+        !m_cache_writers_waiting)
+    {
+      m_cache_readers++;
+      interrupt= FALSE;
+      break;
+    }
+    else if (m_cache_lock_status == Query_cache::LOCKED_NO_WAIT)
+      break;
+    else
+    {
+      struct timespec waittime;
+      set_timespec_nsec(waittime,50000000UL);  /* Wait for 50 msec */
+      int res= mysql_cond_timedwait(&COND_cache_status_changed,
+                                    &structure_guard_mutex, &waittime);
+      if (res == ETIMEDOUT)
+        break;
+    }
+  }
+  if (interrupt)
+    m_requests_in_progress--;
+  mysql_mutex_unlock(&structure_guard_mutex);
+
+  DBUG_RETURN(interrupt);
+}
+
+
+/**
+  Release a lock that was acquired by try_lock_shared().
+
+  @param hit  the query that was served from the cache, or NULL
+*/
+
+void Query_cache::unlock_shared(Query_cache_block *hit)
+{
+  DBUG_ENTER("Query_cache::unlock_shared");
+  mysql_mutex_lock(&structure_guard_mutex);
+  DBUG_ASSERT(m_cache_lock_status == Query_cache::UNLOCKED);
+  DBUG_ASSERT(m_cache_readers > 0);
+  if (hit)
+  {
+    /* The query list is only traversed by holders of an exclusive lock */
+    move_to_query_list_end(hit);
+    hits++;
+    hit->query()->increment_hits();
+  }
+  if (!--m_cache_readers)
+    mysql_cond_broadcast(&COND_cache_status_changed);
   DBUG_ASSERT(m_requests_in_progress > 0);
   m_requests_in_progress--;
   if (m_requests_in_progress == 0 && m_cache_status == DISABLE_REQUEST)
@@ -1876,13 +1983,11 @@ Query_cache::send_result_to_client(THD *thd, char *org_sql, uint query_length)
     }
   }
   /*
-    Try to obtain an exclusive lock on the query cache. If the cache is
+    Try to obtain a shared lock on the query cache. If the cache is
     disabled or if a full cache flush is in progress, the attempt to
-    get the lock is aborted.
-
-    The TIMEOUT parameter indicate that the lock is allowed to timeout.
+    get the lock is aborted. The lock is allowed to timeout.
   */
-  if (try_lock(thd, Query_cache::TIMEOUT))
+  if (try_lock_shared(thd))
     goto err;
 
   if (query_cache_size == 0)
@@ -2002,10 +2107,10 @@ def_week_frmt: %zu, in_trans: %d, autocommit: %d",
 #ifdef WITH_WSREP
   if (once_more && WSREP_CLIENT(thd) && wsrep_must_sync_wait(thd))
   {
-    unlock();
+    unlock_shared();
     if (wsrep_sync_wait(thd))
       goto err;
-    if (try_lock(thd, Query_cache::TIMEOUT))
+    if (try_lock_shared(thd))
       goto err;
     once_more= false;
     goto lookup;
@@ -2062,7 +2167,7 @@ def_week_frmt: %zu, in_trans: %d, autocommit: %d",
       DBUG_PRINT("qcache",
                  ("Temporary table detected: '%s.%s'",
                   tmptable->db.str, tmptable->table_name.str));
-      unlock();
+      unlock_shared();
       /*
         We should not store result of this query because it contain
         temporary tables => assign following variable to make check
@@ -2086,7 +2191,7 @@ def_week_frmt: %zu, in_trans: %d, autocommit: %d",
       DBUG_PRINT("qcache",
 		 ("probably no SELECT access to %s.%s =>  return to normal processing",
 		  table_list.db.str, table_list.alias.str));
-      unlock();
+      unlock_shared();
       thd->query_cache_is_applicable= 0;        // Query can't be cached
       thd->lex->safe_to_cache_query= 0;         // For prepared statements
       BLOCK_UNLOCK_RD(query_block);
@@ -2125,14 +2230,21 @@ def_week_frmt: %zu, in_trans: %d, autocommit: %d",
         DBUG_PRINT("qcache", ("Handler does not allow caching for %.*s",
                               (int)qcache_se_key_len, qcache_se_key_name));
         BLOCK_UNLOCK_RD(query_block);
+        uchar *invalidate_key= NULL;
+        size_t invalidate_key_length= 0;
         if (engine_data != table->engine_data())
         {
           DBUG_PRINT("qcache",
                      ("Handler require invalidation queries of %.*s %llu-%llu",
                       (int)qcache_se_key_len, qcache_se_key_name,
                       engine_data, table->engine_data()));
-          invalidate_table_internal((uchar *) table->db(),
-                                    table->key_length());
+          /*
+            Invalidation requires an exclusive lock. Copy the key,
+            because table may be freed once the shared lock is released.
+          */
+          invalidate_key_length= table->key_length();
+          invalidate_key= (uchar*) thd->memdup(table->db(),
+                                               invalidate_key_length);
         }
         else
         {
@@ -2149,6 +2261,12 @@ def_week_frmt: %zu, in_trans: %d, autocommit: %d",
         */
         DBUG_ASSERT(! thd->transaction_rollback_request);
         trans_rollback_stmt(thd);
+        if (invalidate_key)
+        {
+          unlock_shared();
+          invalidate_table(thd, invalidate_key, invalidate_key_length);
+          goto miss;
+        }
         goto err_unlock;				// Parse query
       }
     }
@@ -2156,10 +2274,7 @@ def_week_frmt: %zu, in_trans: %d, autocommit: %d",
       DBUG_PRINT("qcache", ("handler allow caching %s,%s",
 			    table_list.db.str, table_list.alias.str));
   }
-  move_to_query_list_end(query_block);
-  hits++;
-  query->increment_hits();
-  unlock();
+  unlock_shared(query_block);
 
   /*
     Send cached result to client
@@ -2212,7 +2327,8 @@ def_week_frmt: %zu, in_trans: %d, autocommit: %d",
   DBUG_RETURN(1);				// Result sent to client
 
 err_unlock:
-  unlock();
+  unlock_shared();
+miss:
   MYSQL_QUERY_CACHE_MISS(thd->query());
   /*
     query_plan_flags doesn't have to be changed here as it contains
@@ -2555,6 +2671,8 @@ void Query_cache::init()
   m_cache_lock_status= Query_cache::UNLOCKED;
   m_cache_status= Query_cache::OK;
   m_requests_in_progress= 0;
+  m_cache_readers= 0;
+  m_cache_writers_waiting= 0;
   initialized = 1;
   /*
     Using state_map from latin1 should be fine in all cases:
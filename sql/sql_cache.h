@@ -313,6 +313,10 @@ class Query_cache
 #endif
   mysql_cond_t COND_cache_status_changed;
   uint m_requests_in_progress;
+  /* number of threads holding the cache by try_lock_shared() */
+  uint m_cache_readers;
+  /* number of threads waiting in lock() or try_lock() */
+  uint m_cache_writers_waiting;
   enum Cache_lock_status { UNLOCKED, LOCKED_NO_WAIT, LOCKED };
   Cache_lock_status m_cache_lock_status;
   enum Cache_staus {OK, DISABLE_REQUEST, DISABLED};
@@ -539,6 +543,8 @@ class Query_cache
   void lock(THD *thd);
   void lock_and_suspend(void);
   void unlock(void);
+  bool try_lock_shared(THD *thd);
+  void unlock_shared(Query_cache_block *hit= NULL);
 
   void disable_query_cache(THD *thd);
 };
@@ -504,6 +504,12 @@ int thd_sql_command(const THD *thd)
   return (int) thd->lex->sql_command;
 }
 
+/** Returns whether the statement is EXPLAIN (or DESCRIBE) */
+bool thd_is_explain(const THD *thd)
+{
+  return thd->lex->describe;
+}
+
 /*
   Returns options used with DDL's, like IF EXISTS etc...
   Will returns 'nonsense' if the command was not a DDL.
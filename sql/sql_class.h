@@ -827,6 +827,7 @@ typedef struct system_variables
   uint column_compression_threshold;
   uint column_compression_zlib_level;
   uint in_subquery_conversion_threshold;
+  uint max_sort_threads;
   int max_user_connections;
 
   /**
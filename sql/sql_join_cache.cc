@@ -2841,7 +2841,7 @@ int JOIN_CACHE_HASHED::init(bool for_explain)
   ref_key_info= join_tab->get_keyinfo_by_key_no(join_tab->ref.key);
   ref_used_key_parts= join_tab->ref.key_parts;
 
-  hash_func= &JOIN_CACHE_HASHED::get_hash_idx_simple;
+  hash_func= &JOIN_CACHE_HASHED::get_hash_simple;
   hash_cmp_func= &JOIN_CACHE_HASHED::equal_keys_simple;
 
   KEY_PART_INFO *key_part= ref_key_info->key_part;
@@ -2850,7 +2850,7 @@ int JOIN_CACHE_HASHED::init(bool for_explain)
   {
     if (!key_part->field->eq_cmp_as_binary())
     {
-      hash_func= &JOIN_CACHE_HASHED::get_hash_idx_complex;
+      hash_func= &JOIN_CACHE_HASHED::get_hash_complex;
       hash_cmp_func= &JOIN_CACHE_HASHED::equal_keys_complex;
       break;
     }
@@ -2904,6 +2904,7 @@ int JOIN_CACHE_HASHED::init_hash_table()
   {    
     key_entry_length= get_size_of_rec_offset() + // key chain header
                       size_of_key_ofs +          // reference to the next key 
+                      size_of_key_hash +         // hash value of the key
                       (use_emb_key ?  get_size_of_rec_offset() : key_length);
 
     size_t space_per_rec= avg_record_length +
@@ -2993,6 +2994,7 @@ uint JOIN_CACHE_HASHED::get_max_key_addon_space_per_record()
   len= (use_emb_key ?  get_size_of_rec_offset() : ref->key_length) +
         size_of_rec_ofs +    // size of the key chain header
         size_of_rec_ofs +    // >= size of the reference to the next key 
+        size_of_key_hash +   // size of the hash value of the key
         2*size_of_rec_ofs;   // >= 2*( size of hash table entry)
   return len; 
 }    
@@ -3113,6 +3115,8 @@ bool JOIN_CACHE_HASHED::put_record()
     store_null_key_ref(cp);
     store_next_rec_ref(next_ref_ptr, next_ref_ptr);
     store_next_rec_ref(cp+get_size_of_key_offset(), next_ref_ptr);
+    cp-= size_of_key_hash;
+    int4store(cp, last_key_hash);
     if (use_emb_key)
     {
       cp-= get_size_of_rec_offset();
@@ -3232,6 +3236,9 @@ bool JOIN_CACHE_HASHED::skip_if_not_needed_match()
     to the next key from  to the hash element for the given key. 
     Otherwise the function returns the position where the reference to the
     newly created hash element for the given key is to be added.  
+    The keys of the key entries are compared with the given key only if
+    their stored hash values are equal to the hash value of the given key.
+    The hash value of the given key is saved in last_key_hash.
 
   RETURN VALUE
     TRUE    the key is found in the hash table
@@ -3242,14 +3249,19 @@ bool JOIN_CACHE_HASHED::key_search(uchar *key, uint key_len,
                                    uchar **key_ref_ptr) 
 {
   bool is_found= FALSE;
-  uint idx= (this->*hash_func)(key, key_length);
+  uint32 hash= (this->*hash_func)(key, key_length);
+  uint idx= hash % hash_entries;
   uchar *ref_ptr= hash_table+size_of_key_ofs*idx;
+  last_key_hash= hash;
   while (!is_null_key_ref(ref_ptr))
   {
     uchar *next_key;
     ref_ptr= get_next_key_ref(ref_ptr);
-    next_key= use_emb_key ? get_emb_key(ref_ptr-get_size_of_rec_offset()) :
-                            ref_ptr-key_length;
+    uchar *hash_ptr= ref_ptr-size_of_key_hash;
+    if (uint4korr(hash_ptr) != hash)
+      continue;
+    next_key= use_emb_key ? get_emb_key(hash_ptr-get_size_of_rec_offset()) :
+                            hash_ptr-key_length;
 
     if ((this->*hash_cmp_func)(next_key, key, key_len))
     {
@@ -3266,32 +3278,24 @@ bool JOIN_CACHE_HASHED::key_search(uchar *key, uint key_len,
   Hash function that considers a key in the hash table as byte array
 
   SYNOPSIS
-    get_hash_idx_simple()
+    get_hash_simple()
       key             pointer to the key value
       key_len         key value length
       
   DESCRIPTION
-    The function calculates an index of the hash entry in the hash table
-    of the join buffer for the given key. It considers the key just as
-    a sequence of bytes of the length key_len.
+    The function calculates the hash value for the given key. It considers
+    the key just as a sequence of bytes of the length key_len.
+    CRC-32C is used as the hash function: it is computed with hardware
+    instructions on most platforms and it handles several bytes at a time.
 
   RETURN VALUE
-    the calculated index of the hash entry for the given key  
+    the calculated hash value for the given key  
 */
 
 inline
-uint JOIN_CACHE_HASHED::get_hash_idx_simple(uchar* key, uint key_len)
+uint32 JOIN_CACHE_HASHED::get_hash_simple(uchar* key, uint key_len)
 {
-  ulong nr= 1;
-  ulong nr2= 4;
-  uchar *pos= key;
-  uchar *end= key+key_len;
-  for (; pos < end ; pos++)
-  {
-    nr^= (ulong) ((((uint) nr & 63)+nr2)*((uint) *pos))+ (nr << 8);
-    nr2+= 3;
-  }
-  return nr % hash_entries;
+  return my_crc32c(0, key, key_len);
 }
 
 
@@ -3299,14 +3303,14 @@ uint JOIN_CACHE_HASHED::get_hash_idx_simple(uchar* key, uint key_len)
   Hash function that takes into account collations of the components of the key  
 
   SYNOPSIS
-    get_hash_idx_complex()
+    get_hash_complex()
       key             pointer to the key value
       key_len         key value length
       
   DESCRIPTION
-    The function calculates an index of the hash entry in the hash table
-    of the join buffer for the given key. It takes into account that the
-    components of the key may be of a varchar type with different collations.
+    The function calculates the hash value for the given key. It takes into
+    account that the components of the key may be of a varchar type with
+    different collations.
     The function guarantees that the same hash value for any two equal
     keys that may differ as byte sequences.
     The function takes the info about the components of the key, their
@@ -3315,14 +3319,13 @@ uint JOIN_CACHE_HASHED::get_hash_idx_simple(uchar* key, uint key_len)
     operation.
 
   RETURN VALUE
-    the calculated index of the hash entry for the given key  
+    the calculated hash value for the given key  
 */
 
 inline
-uint JOIN_CACHE_HASHED::get_hash_idx_complex(uchar *key, uint key_len)
+uint32 JOIN_CACHE_HASHED::get_hash_complex(uchar *key, uint key_len)
 {
-  return 
-    (uint) (key_hashnr(ref_key_info, ref_used_key_parts, key) % hash_entries);
+  return (uint32) key_hashnr(ref_key_info, ref_used_key_parts, key);
 }
 
 
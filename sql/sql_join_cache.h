@@ -713,9 +713,13 @@ class JOIN_CACHE :public Sql_alloc
         uchar[] value;
         cache_ref *value_ref; // offset from the beginning of the buffer
       } hash_table_key;
+      uint32 hash_value; // full hash value of the key
       key_ref next_key; // offset backward from the beginning of hash table
       cache_ref *last_rec // offset from the beginning of the buffer
     }
+  The full hash value is kept in the key entry so that a search through
+  a list of key entries compares the keys themselves only when their hash
+  values coincide.
   The references linking the records in a chain are always placed at the very
   beginning of the record info stored in the join buffer. The records are 
   linked in a circular list. A new record is always added to the end of this 
@@ -771,12 +775,15 @@ class JOIN_CACHE :public Sql_alloc
 class JOIN_CACHE_HASHED: public JOIN_CACHE
 {
 
-  typedef uint (JOIN_CACHE_HASHED::*Hash_func) (uchar *key, uint key_len);
+  typedef uint32 (JOIN_CACHE_HASHED::*Hash_func) (uchar *key, uint key_len);
   typedef bool (JOIN_CACHE_HASHED::*Hash_cmp_func) (uchar *key1, uchar *key2,
                                                     uint key_len);
   
 private:
 
+  /* Size of the hash value stored in a key entry */
+  static const uint size_of_key_hash= sizeof(uint32);
+
   /* Size of the offset of a key entry in the hash table */
   uint size_of_key_ofs;
 
@@ -799,8 +806,11 @@ class JOIN_CACHE_HASHED: public JOIN_CACHE
   /* The offset of the data fields from the beginning of the record fields */
   uint data_fields_offset;
 
-  inline uint get_hash_idx_simple(uchar *key, uint key_len);
-  inline uint get_hash_idx_complex(uchar *key, uint key_len);
+  /* The hash value of the key last looked for by key_search() */
+  uint32 last_key_hash;
+
+  inline uint32 get_hash_simple(uchar *key, uint key_len);
+  inline uint32 get_hash_complex(uchar *key, uint key_len);
 
   inline bool equal_keys_simple(uchar *key1, uchar *key2, uint key_len);
   inline bool equal_keys_complex(uchar *key1, uchar *key2, uint key_len);
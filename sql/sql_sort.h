@@ -559,6 +559,8 @@ class Sort_param {
   */
   uint res_length;
   uint max_keys_per_buffer;   // Max keys / buffer.
+  uint max_sort_threads;      // Max threads sorting one buffer.
+  uint sort_threads_used;     // Max threads that sorted a buffer.
   uint min_dupl_count;
   ha_rows limit_rows;         // Select limit, or HA_POS_ERROR if unlimited.
   ha_rows examined_rows;      // Number of examined rows.
@@ -2605,6 +2605,15 @@ static Sys_var_ulong Sys_max_sort_length(
        SESSION_VAR(max_sort_length), CMD_LINE(REQUIRED_ARG),
        VALID_RANGE(64, 8192*1024L), DEFAULT(1024), BLOCK_SIZE(1));
 
+static Sys_var_uint Sys_max_sort_threads(
+       "max_sort_threads",
+       "Maximum number of threads that filesort may use to sort the contents "
+       "of one sort buffer. 1 means that sorting is done by the thread "
+       "executing the query. The sort threads are shared by all "
+       "connections, and at most one per CPU is running at a time",
+       SESSION_VAR(max_sort_threads), CMD_LINE(REQUIRED_ARG),
+       VALID_RANGE(1, 256), DEFAULT(1), BLOCK_SIZE(1));
+
 static Sys_var_ulong Sys_max_sp_recursion_depth(
        "max_sp_recursion_depth",
        "Maximum stored procedure recursion depth",
@@ -4202,6 +4211,23 @@ Sys_threadpool_dedicated_listener(
   GLOBAL_VAR(threadpool_dedicated_listener), CMD_LINE(OPT_ARG), DEFAULT(FALSE),
   NO_MUTEX_GUARD, NOT_IN_BINLOG
 );
+
+static Sys_var_on_access_global<Sys_var_mybool,
+                                PRIV_SET_SYSTEM_GLOBAL_VAR_THREAD_POOL>
+Sys_threadpool_work_stealing(
+  "thread_pool_work_stealing",
+  "If set to 1, a worker thread that finds no work in its own group "
+  "will pick up queued connections from other groups",
+  GLOBAL_VAR(threadpool_work_stealing), CMD_LINE(OPT_ARG), DEFAULT(FALSE),
+  NO_MUTEX_GUARD, NOT_IN_BINLOG
+);
+
+static Sys_var_mybool Sys_threadpool_io_uring(
+  "thread_pool_io_uring",
+  "If set to 1, use io_uring instead of epoll to wait for network I/O "
+  "in thread groups. Only supported on Linux",
+  READ_ONLY GLOBAL_VAR(threadpool_io_uring), CMD_LINE(OPT_ARG),
+  DEFAULT(FALSE));
 #endif /* HAVE_POOL_OF_THREADS */
 
 /**
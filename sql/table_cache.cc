@@ -62,7 +62,14 @@ static std::atomic<bool> tc_contention_warning_reported;
 
 /** Data collections. */
 static LF_HASH tdc_hash; /**< Collection of TABLE_SHARE objects. */
-/** Collection of unused TABLE_SHARE objects. */
+/**
+  Collection of unused TABLE_SHARE objects, least recently used first.
+
+  tdc_acquire_share() does not remove a share that is being used again,
+  so that the global LOCK_unused_shares is not acquired when a cached
+  share is found. Such shares are skipped by tdc_purge() and moved to
+  the end of the list by tdc_release_share().
+*/
 static
 I_P_List <TDC_element,
           I_P_List_adapter<TDC_element, &TDC_element::next, &TDC_element::prev>,
@@ -480,6 +487,23 @@ static void tdc_assert_clean_share(TDC_element *element)
 }
 
 
+/**
+  Remove share from unused_shares, if it is there.
+*/
+
+static void tdc_unlink_unused_share(TDC_element *element)
+{
+  mysql_mutex_assert_owner(&LOCK_unused_shares);
+  mysql_mutex_assert_owner(&element->LOCK_table_share);
+  if (element->prev)
+  {
+    unused_shares.remove(element);
+    element->prev= 0;
+    element->next= 0;
+  }
+}
+
+
 /**
   Delete share from hash and free share object.
 */
@@ -803,7 +827,6 @@ TABLE_SHARE *tdc_acquire_share(THD *thd, TABLE_LIST *tl, uint flags,
   const char *key;
   uint key_length= get_table_def_key(tl, &key);
   my_hash_value_type hash_value= tl->mdl_request.key.tc_hash_value();
-  bool was_unused;
   DBUG_ENTER("tdc_acquire_share");
 
   if (fix_thd_pins(thd))
@@ -911,25 +934,12 @@ TABLE_SHARE *tdc_acquire_share(THD *thd, TABLE_LIST *tl, uint flags,
     goto err;
   }
 
-  was_unused= !element->ref_count;
+  /*
+    If the share was unused, it is left in unused_shares, to avoid
+    acquiring LOCK_unused_shares here. tdc_purge() will skip it.
+  */
   element->ref_count++;
   mysql_mutex_unlock(&element->LOCK_table_share);
-  if (was_unused)
-  {
-    mysql_mutex_lock(&LOCK_unused_shares);
-    if (element->prev)
-    {
-      /*
-        Share was not used before and it was in the old_unused_share list
-        Unlink share from this list
-      */
-      DBUG_PRINT("info", ("Unlinking from not used list"));
-      unused_shares.remove(element);
-      element->next= 0;
-      element->prev= 0;
-    }
-    mysql_mutex_unlock(&LOCK_unused_shares);
-  }
 
 end:
   DBUG_PRINT("exit", ("share: %p  ref_count: %u",
@@ -989,6 +999,8 @@ void tdc_release_share(TABLE_SHARE *share)
     mysql_mutex_unlock(&LOCK_unused_shares);
     DBUG_VOID_RETURN;
   }
+  /* The share may still be in the list, see tdc_acquire_share() */
+  tdc_unlink_unused_share(share->tdc);
   if (share->tdc->flushed || tdc_records() > tdc_size)
   {
     mysql_mutex_unlock(&LOCK_unused_shares);
@@ -997,7 +1009,6 @@ void tdc_release_share(TABLE_SHARE *share)
   }
   /* Link share last in used_table_share list */
   DBUG_PRINT("info", ("moving share to unused list"));
-  DBUG_ASSERT(share->tdc->next == 0);
   unused_shares.push_back(share->tdc);
   mysql_mutex_unlock(&share->tdc->LOCK_table_share);
   mysql_mutex_unlock(&LOCK_unused_shares);
@@ -1014,6 +1025,17 @@ void tdc_remove_referenced_share(THD *thd, TABLE_SHARE *share)
   mysql_mutex_lock(&share->tdc->LOCK_table_share);
   DEBUG_SYNC(thd, "before_wait_for_refs");
   share->tdc->wait_for_refs(1);
+  /*
+    The share may still be in unused_shares, see tdc_acquire_share().
+    Acquiring LOCK_unused_shares also ensures that a concurrent
+    tdc_purge() is not about to look at it.
+  */
+  mysql_mutex_unlock(&share->tdc->LOCK_table_share);
+  mysql_mutex_lock(&LOCK_unused_shares);
+  mysql_mutex_lock(&share->tdc->LOCK_table_share);
+  tdc_unlink_unused_share(share->tdc);
+  mysql_mutex_unlock(&LOCK_unused_shares);
+  share->tdc->wait_for_refs(1);
   DBUG_ASSERT(share->tdc->all_tables.is_empty());
   share->tdc->ref_count--;
   tdc_delete_share_from_hash(share->tdc);
@@ -1051,12 +1073,7 @@ void tdc_remove_table(THD *thd, const char *db, const char *table_name)
 
   if (!element->ref_count)
   {
-    if (element->prev)
-    {
-      unused_shares.remove(element);
-      element->prev= 0;
-      element->next= 0;
-    }
+    tdc_unlink_unused_share(element);
     mysql_mutex_unlock(&LOCK_unused_shares);
 
     tdc_delete_share_from_hash(element);
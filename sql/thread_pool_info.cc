@@ -173,6 +173,13 @@ static ST_FIELD_INFO stats_fields_info[] =
   Column("POLLS_BY_WORKER",               SLonglong(19), NOT_NULL),
   Column("DEQUEUES_BY_LISTENER",          SLonglong(19), NOT_NULL),
   Column("DEQUEUES_BY_WORKER",            SLonglong(19), NOT_NULL),
+  Column("STEALS",                        SLonglong(19), NOT_NULL),
+  Column("QUEUEING_TIME_UNDER_100US",     SLonglong(19), NOT_NULL),
+  Column("QUEUEING_TIME_UNDER_1MS",       SLonglong(19), NOT_NULL),
+  Column("QUEUEING_TIME_UNDER_10MS",      SLonglong(19), NOT_NULL),
+  Column("QUEUEING_TIME_UNDER_100MS",     SLonglong(19), NOT_NULL),
+  Column("QUEUEING_TIME_UNDER_1S",        SLonglong(19), NOT_NULL),
+  Column("QUEUEING_TIME_OVER_1S",         SLonglong(19), NOT_NULL),
   CEnd()
 };
 
@@ -202,6 +209,10 @@ static int stats_fill_table(THD* thd, TABLE_LIST* tables, COND*)
     table->field[8]->store(counters->polls[(int)operation_origin::WORKER], true);
     table->field[9]->store(counters->dequeues[(int)operation_origin::LISTENER], true);
     table->field[10]->store(counters->dequeues[(int)operation_origin::WORKER], true);
+    table->field[11]->store(counters->steals, true);
+    /* QUEUEING_TIME_* histogram buckets */
+    for (uint b = 0; b < TP_QUEUEING_TIME_BUCKETS; b++)
+      table->field[12 + b]->store(counters->queueing_times[b], true);
     mysql_mutex_unlock(&group->mutex);
     if (schema_table_store_record(thd, table))
       return 1;
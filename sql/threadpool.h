@@ -28,6 +28,8 @@ extern uint threadpool_oversubscribe;  /* Maximum active threads in group */
 extern uint threadpool_prio_kickup_timer;  /* Time before low prio item gets prio boost */
 extern my_bool threadpool_exact_stats; /* Better queueing time stats for information_schema, at small performance cost */
 extern my_bool threadpool_dedicated_listener; /* Listener thread does not pick up work items. */
+extern my_bool threadpool_io_uring; /* Use io_uring instead of epoll on Linux */
+extern my_bool threadpool_work_stealing; /* Idle workers pick up work of other groups */
 #ifdef _WIN32
 extern uint threadpool_mode; /* Thread pool implementation , windows or generic */
 #define TP_MODE_WINDOWS 0
@@ -63,6 +65,7 @@ extern void tp_set_threadpool_size(uint val);
 extern void tp_set_threadpool_stall_limit(uint val);
 extern int tp_get_idle_thread_count();
 extern int tp_get_thread_count();
+extern const char *tp_get_poll_backend();
 
 
 enum  TP_PRIORITY {
@@ -132,6 +135,8 @@ struct TP_pool
   virtual int set_stall_limit(uint){ return 0; }
   virtual int get_thread_count() { return tp_stats.num_worker_threads; }
   virtual int get_idle_thread_count(){ return 0; }
+  /** @return the mechanism that waits for network I/O */
+  virtual const char *get_poll_backend() { return ""; }
   virtual void resume(TP_connection* c)=0;
 };
 
@@ -160,6 +165,7 @@ struct TP_pool_generic :TP_pool
   virtual int set_pool_size(uint);
   virtual int set_stall_limit(uint);
   virtual int get_idle_thread_count();
+  virtual const char *get_poll_backend();
   void resume(TP_connection* c);
 };
 
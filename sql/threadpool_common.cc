@@ -47,6 +47,8 @@ uint threadpool_mode;
 uint threadpool_prio_kickup_timer;
 my_bool threadpool_exact_stats;
 my_bool threadpool_dedicated_listener;
+my_bool threadpool_io_uring;
+my_bool threadpool_work_stealing;
 
 /* Stats */
 TP_STATISTICS tp_stats;
@@ -507,6 +509,11 @@ int tp_get_thread_count()
   return pool ? pool->get_thread_count() : 0;
 }
 
+const char *tp_get_poll_backend()
+{
+  return pool ? pool->get_poll_backend() : "";
+}
+
 void tp_set_min_threads(uint val)
 {
   if (pool)
@@ -29,6 +29,11 @@
 #include <sql_plist.h>
 #include <threadpool.h>
 #include <algorithm>
+#ifdef HAVE_URING
+#include <liburing.h>
+#include <poll.h>
+#include <mutex>
+#endif
 #ifdef _WIN32
 #include "threadpool_winsockets.h"
 #define OPTIONAL_IO_POLL_READ_PARAM this
@@ -171,6 +176,7 @@ static void print_pool_blocked_message(bool);
 */
 
 #if defined (__linux__)
+#define IO_POLL_BACKEND "epoll"
 #ifndef EPOLLRDHUP
 /* Early 2.6 kernel did not have EPOLLRDHUP */
 #define EPOLLRDHUP 0
@@ -231,7 +237,108 @@ static void *native_event_get_userdata(native_event *event)
   return event->data.ptr;
 }
 
+#ifdef HAVE_URING
+/*
+  With thread_pool_io_uring=ON, a one-shot IORING_OP_POLL_ADD takes
+  the place of an EPOLLONESHOT registration, and completions are
+  returned as native_event. Unlike epoll_wait(), checking for events
+  without waiting (as done by workers before going to sleep) does not
+  involve a system call, and a single call can reap events for a
+  listener and arm polls for many workers.
+*/
+struct tp_uring
+{
+  struct io_uring ring;
+  /* Serializes the submission queue */
+  std::mutex sq_mutex;
+  /* Serializes the completion queue */
+  std::mutex cq_mutex;
+};
+
+static tp_uring *tp_uring_create()
+{
+  tp_uring *u= new (std::nothrow) tp_uring;
+  if (!u)
+    return NULL;
+  if (int ret= io_uring_queue_init(MAX_EVENTS, &u->ring, 0))
+  {
+    delete u;
+    errno= -ret;
+    return NULL;
+  }
+  return u;
+}
+
+static void tp_uring_close(tp_uring *u)
+{
+  io_uring_queue_exit(&u->ring);
+  delete u;
+}
+
+static int tp_uring_start_read(tp_uring *u, TP_file_handle fd, void *data)
+{
+  std::lock_guard<std::mutex> lock(u->sq_mutex);
+  struct io_uring_sqe *sqe= io_uring_get_sqe(&u->ring);
+  if (!sqe)
+  {
+    errno= EAGAIN;
+    return -1;
+  }
+  io_uring_prep_poll_add(sqe, fd, POLLIN | POLLRDHUP);
+  io_uring_sqe_set_data(sqe, data);
+  int ret= io_uring_submit(&u->ring);
+  if (ret < 0)
+  {
+    errno= -ret;
+    return -1;
+  }
+  return 0;
+}
+
+/*
+  Equivalent of epoll_wait() with timeout 0 or -1. Only one thread at
+  a time can consume completions. If the listener is waiting for
+  events, an attempt to check for events without waiting returns 0.
+*/
+static int tp_uring_wait(tp_uring *u, native_event *events, int maxevents,
+                         int timeout_ms)
+{
+  DBUG_ASSERT(timeout_ms == 0 || timeout_ms == -1);
+  if (timeout_ms)
+    u->cq_mutex.lock();
+  else if (!u->cq_mutex.try_lock())
+    return 0;
+
+  int n= 0, err= 0;
+  while (n < maxevents)
+  {
+    struct io_uring_cqe *cqe;
+    err= n || !timeout_ms
+      ? io_uring_peek_cqe(&u->ring, &cqe)
+      : io_uring_wait_cqe(&u->ring, &cqe);
+    if (err == -EINTR)
+      continue;
+    if (err)
+      break;
+    events[n].data.u64= 0; /* Keep valgrind happy */
+    events[n].data.ptr= io_uring_cqe_get_data(cqe);
+    events[n].events= cqe->res < 0 ? EPOLLERR : uint32_t(cqe->res);
+    io_uring_cqe_seen(&u->ring, cqe);
+    n++;
+  }
+  u->cq_mutex.unlock();
+
+  if (!n && timeout_ms && err)
+  {
+    errno= -err;
+    return -1;
+  }
+  return n;
+}
+#endif /* HAVE_URING */
+
 #elif defined(HAVE_KQUEUE)
+#define IO_POLL_BACKEND "kqueue"
 
 /*
   NetBSD prior to 9.99.17 is incompatible with other BSDs, last parameter
@@ -306,6 +413,7 @@ static void* native_event_get_userdata(native_event *event)
 }
 
 #elif defined (__sun)
+#define IO_POLL_BACKEND "event ports"
 
 static TP_file_handle io_poll_create()
 {
@@ -353,7 +461,7 @@ static void* native_event_get_userdata(native_event *event)
 }
 
 #elif defined(_WIN32)
-
+#define IO_POLL_BACKEND "IOCP"
 
 static TP_file_handle io_poll_create()
 {
@@ -443,6 +551,90 @@ int io_poll_wait(TP_file_handle pollfd, native_event *events, int maxevents,
 #endif
 
 
+/*
+  Wrappers of the io_poll functions for a thread group. On Linux, they
+  use io_uring instead of epoll if thread_pool_io_uring=ON.
+*/
+static int group_poll_create(thread_group_t *thread_group)
+{
+#ifdef HAVE_URING
+  if (threadpool_io_uring)
+  {
+    if (tp_uring *u= tp_uring_create())
+    {
+      thread_group->uring= u;
+      thread_group->pollfd= u->ring.ring_fd;
+      return 0;
+    }
+    sql_print_warning("Threadpool: io_uring_queue_init() failed, errno=%d;"
+                      " falling back to epoll", errno);
+    threadpool_io_uring= false;
+  }
+#endif
+  thread_group->pollfd= io_poll_create();
+  return thread_group->pollfd == INVALID_HANDLE_VALUE ? -1 : 0;
+}
+
+static void group_poll_close(thread_group_t *thread_group)
+{
+#ifdef HAVE_URING
+  if (tp_uring *u= thread_group->uring)
+  {
+    thread_group->uring= NULL;
+    tp_uring_close(u);
+  }
+  else
+#endif
+    io_poll_close(thread_group->pollfd);
+  thread_group->pollfd= INVALID_HANDLE_VALUE;
+}
+
+static int group_poll_associate_fd(thread_group_t *thread_group,
+                                   TP_file_handle fd, void *data, void *opt)
+{
+#ifdef HAVE_URING
+  if (thread_group->uring)
+    return tp_uring_start_read(thread_group->uring, fd, data);
+#endif
+  return io_poll_associate_fd(thread_group->pollfd, fd, data, opt);
+}
+
+static int group_poll_start_read(thread_group_t *thread_group,
+                                 TP_file_handle fd, void *data, void *opt)
+{
+#ifdef HAVE_URING
+  if (thread_group->uring)
+    return tp_uring_start_read(thread_group->uring, fd, data);
+#endif
+  return io_poll_start_read(thread_group->pollfd, fd, data, opt);
+}
+
+static int group_poll_disassociate_fd(thread_group_t *thread_group,
+                                      TP_file_handle fd)
+{
+#ifdef HAVE_URING
+  /*
+    There is nothing to remove, because a connection is only
+    disassociated while no poll for it is pending.
+  */
+  if (thread_group->uring)
+    return 0;
+#endif
+  return io_poll_disassociate_fd(thread_group->pollfd, fd);
+}
+
+static int group_poll_wait(thread_group_t *thread_group,
+                           native_event *events, int maxevents,
+                           int timeout_ms)
+{
+#ifdef HAVE_URING
+  if (thread_group->uring)
+    return tp_uring_wait(thread_group->uring, events, maxevents, timeout_ms);
+#endif
+  return io_poll_wait(thread_group->pollfd, events, maxevents, timeout_ms);
+}
+
+
 /* Dequeue element from a workqueue */
 
 static TP_connection_generic *queue_get(thread_group_t *thread_group)
@@ -459,12 +651,27 @@ static TP_connection_generic *queue_get(thread_group_t *thread_group)
   DBUG_RETURN(0);
 }
 
+/* Find the queueing time histogram bucket for a time in microseconds */
+static uint queueing_time_bucket(ulonglong us)
+{
+  uint bucket= 0;
+  for (ulonglong limit= 100;
+       bucket < TP_QUEUEING_TIME_BUCKETS - 1 && us >= limit;
+       limit*= 10)
+    bucket++;
+  return bucket;
+}
+
 static TP_connection_generic* queue_get(thread_group_t* group, operation_origin origin)
 {
   auto ret = queue_get(group);
   if (ret)
   {
     TP_INCREMENT_GROUP_COUNTER(group, dequeues[(int)origin]);
+    ulonglong now= threadpool_exact_stats?microsecond_interval_timer():pool_timer.current_microtime;
+    /* enqueue_time can be ahead if thread_pool_exact_stats was just changed */
+    ulonglong waited= now > ret->enqueue_time ? now - ret->enqueue_time : 0;
+    TP_INCREMENT_GROUP_COUNTER(group, queueing_times[queueing_time_bucket(waited)]);
   }
   return ret;
 }
@@ -729,7 +936,7 @@ static TP_connection_generic * listener(worker_thread_t *current_thread,
     if (thread_group->shutdown)
       break;
 
-    cnt = io_poll_wait(thread_group->pollfd, ev, MAX_EVENTS, -1);
+    cnt = group_poll_wait(thread_group, ev, MAX_EVENTS, -1);
     TP_INCREMENT_GROUP_COUNTER(thread_group, polls[(int)operation_origin::LISTENER]);
     if (cnt <=0)
     {
@@ -998,10 +1205,7 @@ void thread_group_destroy(thread_group_t *thread_group)
 {
   mysql_mutex_destroy(&thread_group->mutex);
   if (thread_group->pollfd != INVALID_HANDLE_VALUE)
-  {
-    io_poll_close(thread_group->pollfd);
-    thread_group->pollfd= INVALID_HANDLE_VALUE;
-  }
+    group_poll_close(thread_group);
 #ifndef _WIN32
   for(int i=0; i < 2; i++)
   {
@@ -1056,7 +1260,7 @@ static int wake_listener(thread_group_t *thread_group)
   }
 
   /* Wake listener */
-  if (io_poll_associate_fd(thread_group->pollfd,
+  if (group_poll_associate_fd(thread_group,
     thread_group->shutdown_pipe[0], NULL, NULL))
   {
     return -1;
@@ -1139,6 +1343,64 @@ static bool too_many_threads(thread_group_t *thread_group)
 }
 
 
+/**
+  Take a queued connection from another thread group (work stealing).
+
+  Connections are assigned to groups by thread_id, so a few busy
+  connections can keep one group's queue long while workers of other
+  groups are idle. Rather than sleeping, an idle worker of thief group
+  can take over a queued connection of another group, which then stays
+  in the thief group (the same way as in change_group()).
+
+  The victim group mutex is only try-locked, because the thief group
+  mutex is already held and there is no lock order between groups.
+
+  @param thief  group of the calling worker, its mutex must be held
+  @return connection that is now owned by thief group, or NULL
+*/
+
+static TP_connection_generic *steal_connection(thread_group_t *thief)
+{
+  mysql_mutex_assert_owner(&thief->mutex);
+  const uint count= group_count;
+  const uint thief_id= (uint)(thief - all_groups);
+  if (thief_id >= count)
+    return NULL;
+
+  for (uint i= 1; i < count; i++)
+  {
+    thread_group_t *victim= &all_groups[(thief_id + i) % count];
+    /* Unprotected peek, to avoid locking groups that have nothing queued */
+    if (is_queue_empty(victim) || mysql_mutex_trylock(&victim->mutex))
+      continue;
+
+    TP_connection_generic *c= victim->shutdown
+      ? NULL : queue_get(victim, operation_origin::WORKER);
+    if (c)
+    {
+      DBUG_ASSERT(c->thread_group == victim);
+      if (c->bound_to_poll_descriptor)
+      {
+        /* start_io() will associate the fd with the thief group. */
+        group_poll_disassociate_fd(victim, c->fd);
+        c->bound_to_poll_descriptor= false;
+      }
+      victim->connection_count--;
+    }
+    mysql_mutex_unlock(&victim->mutex);
+
+    if (c)
+    {
+      c->thread_group= thief;
+      thief->connection_count++;
+      TP_INCREMENT_GROUP_COUNTER(thief, steals);
+      return c;
+    }
+  }
+  return NULL;
+}
+
+
 /**
   Retrieve a connection with pending event.
 
@@ -1209,7 +1471,7 @@ TP_connection_generic *get_event(worker_thread_t *current_thread,
     if (!oversubscribed && !threadpool_dedicated_listener)
     {
       native_event ev[MAX_EVENTS];
-      int cnt = io_poll_wait(thread_group->pollfd, ev, MAX_EVENTS, 0);
+      int cnt = group_poll_wait(thread_group, ev, MAX_EVENTS, 0);
       TP_INCREMENT_GROUP_COUNTER(thread_group, polls[(int)operation_origin::WORKER]);
       if (cnt > 0)
       {
@@ -1219,6 +1481,14 @@ TP_connection_generic *get_event(worker_thread_t *current_thread,
       }
     }
 
+    /* Before sleeping, look for work that other groups did not get to. */
+    if (!oversubscribed && threadpool_work_stealing)
+    {
+      connection= steal_connection(thread_group);
+      if (connection)
+        break;
+    }
+
 
     /* And now, finally sleep */
     current_thread->woken = false; /* wake() sets this to true */
@@ -1467,7 +1737,7 @@ static int change_group(TP_connection_generic *c,
   mysql_mutex_lock(&old_group->mutex);
   if (c->bound_to_poll_descriptor)
   {
-    io_poll_disassociate_fd(old_group->pollfd,c->fd);
+    group_poll_disassociate_fd(old_group, c->fd);
     c->bound_to_poll_descriptor= false;
   }
   c->thread_group->connection_count--;
@@ -1515,10 +1785,10 @@ int TP_connection_generic::start_io()
   if (!bound_to_poll_descriptor)
   {
     bound_to_poll_descriptor= true;
-    return io_poll_associate_fd(thread_group->pollfd, fd, this, OPTIONAL_IO_POLL_READ_PARAM);
+    return group_poll_associate_fd(thread_group, fd, this, OPTIONAL_IO_POLL_READ_PARAM);
   }
 
-  return io_poll_start_read(thread_group->pollfd, fd, this, OPTIONAL_IO_POLL_READ_PARAM);
+  return group_poll_start_read(thread_group, fd, this, OPTIONAL_IO_POLL_READ_PARAM);
 }
 
 
@@ -1592,6 +1862,14 @@ int TP_pool_generic::init()
   PSI_register(mutex);
   PSI_register(cond);
   PSI_register(thread);
+#ifndef HAVE_URING
+  if (threadpool_io_uring)
+  {
+    sql_print_warning("Threadpool: thread_pool_io_uring=ON is not supported"
+                      " by this build or platform; ignored");
+    threadpool_io_uring= false;
+  }
+#endif
   scheduler_init();
   threadpool_started= true;
   for (uint i= 0; i < threadpool_max_size; i++)
@@ -1655,8 +1933,7 @@ int TP_pool_generic::set_pool_size(uint size)
     mysql_mutex_lock(&group->mutex);
     if (group->pollfd == INVALID_HANDLE_VALUE)
     {
-      group->pollfd= io_poll_create();
-      success= (group->pollfd != INVALID_HANDLE_VALUE);
+      success= !group_poll_create(group);
       if(!success)
       {
         sql_print_error("io_poll_create() failed, errno=%d", errno);
@@ -1702,6 +1979,17 @@ int TP_pool_generic::get_idle_thread_count()
 }
 
 
+const char *TP_pool_generic::get_poll_backend()
+{
+#ifdef HAVE_URING
+  /* Reset if io_uring could not be initialized for a group */
+  if (threadpool_io_uring)
+    return "io_uring";
+#endif
+  return IO_POLL_BACKEND;
+}
+
+
 /* Report threadpool problems */
 
 /**
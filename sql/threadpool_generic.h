@@ -116,6 +116,13 @@ enum class operation_origin
   LISTENER
 };
 
+/*
+  Number of buckets in the queueing time histogram of a thread group.
+  Bucket i counts dequeued connections that waited less than 100*10^i
+  microseconds, the last bucket counts the rest.
+*/
+#define TP_QUEUEING_TIME_BUCKETS 6
+
 struct thread_group_counters_t
 {
   ulonglong thread_creations;
@@ -126,6 +133,8 @@ struct thread_group_counters_t
   ulonglong stalls;
   ulonglong dequeues[2];
   ulonglong polls[2];
+  ulonglong steals;
+  ulonglong queueing_times[TP_QUEUEING_TIME_BUCKETS];
 };
 
 struct thread_group_t
@@ -136,6 +145,10 @@ struct thread_group_t
   worker_thread_t* listener;
   pthread_attr_t* pthread_attr;
   TP_file_handle  pollfd;
+#ifdef __linux__
+  /* io_uring instance used instead of epoll, or NULL (see pollfd) */
+  struct tp_uring *uring;
+#endif
   int  thread_count;
   int  active_thread_count;
   int  connection_count;
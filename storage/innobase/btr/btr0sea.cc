@@ -1022,6 +1022,71 @@ inline buf_block_t* buf_pool_t::block_from_ahi(const byte *ptr) const
   return block;
 }
 
+/** Look up a record in the adaptive hash index, and latch and
+buffer-fix the page that contains it.
+@param part        adaptive hash index partition of the index
+@param fold        hash value of the search key
+@param index       index
+@param latch_mode  BTR_SEARCH_LEAF or BTR_MODIFY_LEAF
+@param rec         the record that was found
+@return the latched and buffer-fixed block
+@retval nullptr if the lookup failed */
+TRANSACTIONAL_TARGET
+static buf_block_t *btr_search_guess_block(btr_search_sys_t::partition *part,
+                                           ulint fold,
+                                           const dict_index_t *index,
+                                           ulint latch_mode,
+                                           const rec_t *&rec)
+{
+  /* All threads would otherwise be updating the lock word of the
+  partition of a frequently searched index. */
+  transactional_shared_lock_guard<srw_spin_lock> g{part->latch};
+
+  if (!btr_search_enabled)
+    return nullptr;
+
+  rec= static_cast<const rec_t*>(ha_search_and_get_data(&part->table, fold));
+  if (!rec)
+    return nullptr;
+
+  buf_block_t *block= buf_pool.block_from_ahi(rec);
+  buf_pool_t::hash_chain &chain=
+    buf_pool.page_hash.cell_get(block->page.id().fold());
+  bool got_latch;
+  {
+    transactional_shared_lock_guard<page_hash_latch> hg
+      {buf_pool.page_hash.lock_get(chain)};
+    got_latch= latch_mode == BTR_SEARCH_LEAF
+      ? block->page.lock.s_lock_try()
+      : block->page.lock.x_lock_try();
+  }
+
+  if (!got_latch)
+    return nullptr;
+
+  const auto state= block->page.state();
+  if (UNIV_UNLIKELY(state < buf_page_t::UNFIXED))
+    ut_ad(state == buf_page_t::REMOVE_HASH);
+  else
+  {
+    ut_ad(state < buf_page_t::READ_FIX || state >= buf_page_t::WRITE_FIX);
+    ut_ad(state < buf_page_t::READ_FIX || latch_mode == BTR_SEARCH_LEAF);
+
+    if (index == block->index || index->id != block->index->id)
+    {
+      block->page.fix();
+      return block;
+    }
+    ut_a(block->index->freed());
+  }
+
+  if (latch_mode == BTR_SEARCH_LEAF)
+    block->page.lock.s_unlock();
+  else
+    block->page.lock.x_unlock();
+  return nullptr;
+}
+
 /** Tries to guess the right search position based on the hash search info
 of the index. Note that if mode is PAGE_CUR_LE, which is used in inserts,
 and the function returns TRUE, then cursor->up_match and cursor->low_match
@@ -1084,72 +1149,21 @@ btr_search_guess_on_hash(
 	cursor->fold = fold;
 	cursor->flag = BTR_CUR_HASH;
 
-	auto part = btr_search_sys.get_part(*index);
 	const rec_t* rec;
+	buf_block_t* block = btr_search_guess_block(
+		btr_search_sys.get_part(*index), fold, index, latch_mode, rec);
 
-	part->latch.rd_lock(SRW_LOCK_CALL);
-
-	if (!btr_search_enabled) {
-		goto ahi_release_and_fail;
-	}
-
-	rec = static_cast<const rec_t*>(
-		ha_search_and_get_data(&part->table, fold));
-
-	if (!rec) {
-ahi_release_and_fail:
-		part->latch.rd_unlock();
+	if (!block) {
 fail:
 		btr_search_failure(info, cursor);
 		return false;
 	}
 
-	buf_block_t* block = buf_pool.block_from_ahi(rec);
-
-	buf_pool_t::hash_chain& chain = buf_pool.page_hash.cell_get(
-		block->page.id().fold());
-	bool got_latch;
-	{
-		transactional_shared_lock_guard<page_hash_latch> g{
-			buf_pool.page_hash.lock_get(chain)};
-		got_latch = (latch_mode == BTR_SEARCH_LEAF)
-			? block->page.lock.s_lock_try()
-			: block->page.lock.x_lock_try();
-	}
-
-	if (!got_latch) {
-		goto ahi_release_and_fail;
-	}
-
-	const auto state = block->page.state();
-	if (UNIV_UNLIKELY(state < buf_page_t::UNFIXED)) {
-		ut_ad(state == buf_page_t::REMOVE_HASH);
-block_and_ahi_release_and_fail:
-		if (latch_mode == BTR_SEARCH_LEAF) {
-			block->page.lock.s_unlock();
-		} else {
-			block->page.lock.x_unlock();
-		}
-		goto ahi_release_and_fail;
-	}
-
-	ut_ad(state < buf_page_t::READ_FIX || state >= buf_page_t::WRITE_FIX);
-	ut_ad(state < buf_page_t::READ_FIX || latch_mode == BTR_SEARCH_LEAF);
-
-	if (index != block->index && index_id == block->index->id) {
-		ut_a(block->index->freed());
-		goto block_and_ahi_release_and_fail;
-	}
-
-	block->page.fix();
+	/* The page latch and the buffer-fix prevent the block from
+	being evicted, so this can be done outside the critical section.
+	buf_page_make_young() would abort a memory transaction. */
 	block->page.set_accessed();
 	buf_page_make_young_if_needed(&block->page);
-	static_assert(ulint{MTR_MEMO_PAGE_S_FIX} == ulint{BTR_SEARCH_LEAF},
-		      "");
-	static_assert(ulint{MTR_MEMO_PAGE_X_FIX} == ulint{BTR_MODIFY_LEAF},
-		      "");
-
-	part->latch.rd_unlock();
 
 	++buf_pool.stat.n_page_gets;
 
@@ -65,9 +65,13 @@ Created 11/5/1995 Heikki Tuuri
 #endif /* !UNIV_INNOCHECKSUM */
 #include "page0zip.h"
 #include "buf0dump.h"
+#include "buf0tier.h"
 #include <map>
 #include <sstream>
 #include "log.h"
+#ifdef HAVE_SYS_RESOURCE_H
+# include <sys/resource.h>
+#endif
 
 using st_::span;
 
@@ -1104,10 +1108,59 @@ bool buf_pool_t::create()
   chunk_t::map_ref= chunk_t::map_reg;
   buf_LRU_old_ratio_update(100 * 3 / 8, false);
   btr_search_sys_create();
+  register_aio_buffers(true);
   ut_ad(is_initialised());
   return false;
 }
 
+void buf_pool_t::register_aio_buffers(bool enable) const
+{
+  if (!srv_thread_pool || !srv_use_registered_buffers)
+    return;
+
+  std::vector<void*> bufs;
+  std::vector<size_t> sizes;
+
+  if (enable)
+  {
+    size_t total= 0;
+    for (const chunk_t *chunk= chunks, *const echunk= chunks + n_chunks;
+         chunk != echunk; chunk++)
+    {
+      bufs.push_back(chunk->mem);
+      sizes.push_back(chunk->mem_size());
+      total+= chunk->mem_size();
+    }
+
+#if defined HAVE_GETRLIMIT && defined RLIMIT_MEMLOCK
+    /* Registering the buffers pins them in memory. Do not attempt it
+    when the memory lock limit would not allow it. */
+    struct rlimit rl;
+    if (!getrlimit(RLIMIT_MEMLOCK, &rl) && rl.rlim_cur != RLIM_INFINITY &&
+        rl.rlim_cur < total)
+    {
+      sql_print_information("InnoDB: Not registering the buffer pool for"
+                            " asynchronous I/O: RLIMIT_MEMLOCK=%llu"
+                            " is smaller than %zu",
+                            ulonglong(rl.rlim_cur), total);
+      bufs.clear();
+      sizes.clear();
+    }
+#endif
+  }
+
+  switch (int err= srv_thread_pool->register_buffers(bufs.data(),
+                                                     sizes.data(),
+                                                     bufs.size())) {
+  case 0:
+  case ENOTSUP:
+    break;
+  default:
+    ib::warn() << "Could not register the buffer pool for"
+                  " asynchronous I/O: " << strerror(err);
+  }
+}
+
 /** Clean up after successful create() */
 void buf_pool_t::close()
 {
@@ -1115,6 +1168,8 @@ void buf_pool_t::close()
   if (!is_initialised())
     return;
 
+  register_aio_buffers(false);
+
   mysql_mutex_destroy(&mutex);
   mysql_mutex_destroy(&flush_list_mutex);
 
@@ -1680,6 +1735,9 @@ inline void buf_pool_t::resize()
 	mysql_mutex_lock(&mutex);
 	page_hash.write_lock_all();
 
+	/* The chunks may be freed or allocated at the same addresses. */
+	register_aio_buffers(false);
+
 	chunk_t::map_reg = UT_NEW_NOKEY(chunk_t::map());
 
 	/* add/delete chunks */
@@ -1816,6 +1874,8 @@ inline void buf_pool_t::resize()
 	chunk_t::map* chunk_map_old = chunk_t::map_ref;
 	chunk_t::map_ref = chunk_t::map_reg;
 
+	register_aio_buffers(true);
+
 	/* set size */
 	ut_ad(UT_LIST_GET_LEN(withdraw) == 0);
   ulint s= curr_size;
@@ -2972,6 +3032,10 @@ static buf_block_t *buf_page_create_low(page_id_t page_id, ulint zip_size,
   buf_pool.stat.n_pages_created++;
   mysql_mutex_unlock(&buf_pool.mutex);
 
+  /* Discard any copy of the page that was evicted before it was freed,
+  or any reservation by a concurrent buf_LRU_free_page(). */
+  buf_tier.invalidate(page_id);
+
   mtr->memo_push(reinterpret_cast<buf_block_t*>(bpage), MTR_MEMO_PAGE_X_FIX);
 
   bpage->set_accessed();
@@ -34,6 +34,8 @@ Created 2011/12/19
 #include "fil0crypt.h"
 #include "fil0pagecompress.h"
 
+#include <algorithm>
+
 using st_::span;
 
 /** The doublewrite buffer */
@@ -671,16 +673,40 @@ void buf_dblwr_t::flush_buffered_writes_completed(const IORequest &request)
   fil_system.sys_space->flush<false>();
 
   /* The writes have been flushed to disk now and in recovery we will
-  find them in the doublewrite buffer blocks. Next, write the data pages. */
-  for (ulint i= 0, first_free= flush_slot->first_free; i < first_free; i++)
+  find them in the doublewrite buffer blocks. Next, write the data pages.
+  The batch was collected in buf_pool.flush_list order. Submit the writes
+  in ascending order of tablespace and page number, so that writes of
+  adjacent pages will reach the file system back to back. */
+  const element *sorted[2 * FSP_EXTENT_SIZE_MIN];
+  const ulint first_free= flush_slot->first_free;
+  ut_ad(first_free <= array_elements(sorted));
+  lsn_t max_lsn= 0;
+
+  for (ulint i= 0; i < first_free; i++)
   {
-    auto e= flush_slot->buf_block_arr[i];
-    buf_page_t* bpage= e.request.bpage;
-    ut_ad(bpage->in_file());
-
-    void *frame= get_frame(e.request);
+    const element &e= flush_slot->buf_block_arr[i];
+    ut_ad(e.request.bpage->in_file());
+    const byte *frame= static_cast<const byte*>(get_frame(e.request));
     ut_ad(frame);
+    ut_d(if (!e.request.bpage->zip.data)
+           buf_dblwr_check_page_lsn(*e.request.bpage, frame));
+    const lsn_t lsn= mach_read_from_8(my_assume_aligned<8>
+                                      (FIL_PAGE_LSN + frame));
+    ut_ad(lsn);
+    ut_ad(lsn >= e.request.bpage->oldest_modification());
+    max_lsn= std::max(max_lsn, lsn);
+    sorted[i]= &e;
+  }
+
+  std::sort(sorted, sorted + first_free,
+            [](const element *a, const element *b)
+            { return a->request.bpage->id() < b->request.bpage->id(); });
+  log_write_up_to(max_lsn, true);
 
+  for (ulint i= 0; i < first_free; i++)
+  {
+    const element e= *sorted[i];
+    buf_page_t *bpage= e.request.bpage;
     auto e_size= e.size;
 
     if (UNIV_LIKELY_NULL(bpage->zip.data))
@@ -689,19 +715,10 @@ void buf_dblwr_t::flush_buffered_writes_completed(const IORequest &request)
       ut_ad(e_size);
     }
     else
-    {
       ut_ad(!bpage->zip_size());
-      ut_d(buf_dblwr_check_page_lsn(*bpage, static_cast<const byte*>(frame)));
-    }
 
-    const lsn_t lsn= mach_read_from_8(my_assume_aligned<8>
-                                      (FIL_PAGE_LSN +
-                                       static_cast<const byte*>(frame)));
-    ut_ad(lsn);
-    ut_ad(lsn >= bpage->oldest_modification());
-    log_write_up_to(lsn, true);
     e.request.node->space->io(e.request, bpage->physical_offset(), e_size,
-                              frame, bpage);
+                              get_frame(e.request), bpage);
   }
 }
 
@@ -53,6 +53,11 @@ enum status_severity {
 
 #define SHUTTING_DOWN()	(srv_shutdown_state != SRV_SHUTDOWN_NONE)
 
+/** Number of the most recently used pages in the dump that buf_load()
+will read first; each subsequent window is twice the size of the
+previous one. */
+static constexpr ulint BUF_LOAD_FIRST_BATCH = 1024;
+
 /* Flags that tell the buffer pool dump/load thread which action should it
 take after being waked up. */
 static volatile bool	buf_dump_should_start;
@@ -560,13 +565,18 @@ buf_load()
 		return;
 	}
 
-	if (!SHUTTING_DOWN()) {
-		std::sort(dump, dump + dump_n);
+	/* buf_dump() writes the pages in LRU order, most recently used
+	first. Sort dump[] by (space, page) in windows of growing size,
+	so that the hottest pages will be loaded first while most of the
+	reads will still be submitted in ascending file order. */
+	for (ulint begin = 0, n = BUF_LOAD_FIRST_BATCH;
+	     begin < dump_n && !SHUTTING_DOWN(); begin += n, n *= 2) {
+		std::sort(dump + begin, dump + std::min(begin + n, dump_n));
 	}
 
 	/* Avoid calling the expensive fil_space_t::get() for each
-	page within the same tablespace. dump[] is sorted by (space, page),
-	so all pages from a given tablespace are consecutive. */
+	page within the same tablespace. Within each window of dump[],
+	all pages from a given tablespace are consecutive. */
 	uint32_t	cur_space_id = dump[0].space();
 	fil_space_t*	space = fil_space_t::get(cur_space_id);
 	ulint		zip_size = space ? space->zip_size() : 0;
@@ -615,8 +625,21 @@ buf_load()
 			continue;
 		}
 
+		/* Read any adjacent pages of the dump with the same
+		request. The runs are short within the first windows of
+		dump[], which are sorted separately. */
+		ulint	end = i + 1;
+		while (end < dump_n
+		       && end - i < buf_pool_t::READ_AHEAD_PAGES
+		       && dump[end] == dump[end - 1] + 1
+		       && dump[end].page_no() < space->get_size()) {
+			end++;
+		}
+
 		space->reacquire();
-		buf_read_page_background(space, dump[i], zip_size);
+		buf_read_pages_background(space, dump[i],
+					  dump[end - 1] + 1, zip_size);
+		i = end - 1;
 
 		if (buf_load_abort_flag) {
 			if (space) {
@@ -31,6 +31,7 @@ Created 11/5/1995 Heikki Tuuri
 #include "buf0buf.h"
 #include "buf0flu.h"
 #include "buf0rea.h"
+#include "buf0tier.h"
 #include "btr0sea.h"
 #include "os0file.h"
 #include "page0zip.h"
@@ -805,6 +806,7 @@ bool buf_LRU_free_page(buf_page_t *bpage, bool zip)
 {
 	const page_id_t id{bpage->id()};
 	buf_page_t*	b = nullptr;
+	uint64_t	tier_seq = 0;
 
 	mysql_mutex_assert_owner(&buf_pool.mutex);
 
@@ -880,6 +882,12 @@ bool buf_LRU_free_page(buf_page_t *bpage, bool zip)
 
 	ut_ad(bpage->can_relocate());
 
+	if (!b && !bpage->zip.data && bpage->frame && !bpage->is_freed()) {
+		/* Reserve a copy of the clean page in buf_tier while
+		no read of the page can be initiated. */
+		tier_seq = buf_tier.reserve(id, bpage->frame);
+	}
+
 	if (!buf_LRU_block_remove_hashed(bpage, id, chain, zip)) {
 		ut_ad(!b);
 		mysql_mutex_assert_not_owner(&buf_pool.flush_list_mutex);
@@ -976,6 +984,16 @@ bool buf_LRU_free_page(buf_page_t *bpage, bool zip)
 
 	buf_block_t* block = reinterpret_cast<buf_block_t*>(bpage);
 
+	if (tier_seq) {
+		mysql_mutex_unlock(&buf_pool.mutex);
+		/* The page is no longer in buf_pool.page_hash, but
+		its contents are valid. See the comment below. */
+		MEM_MAKE_DEFINED(block->page.frame, srv_page_size);
+		buf_tier.fill(id, tier_seq, block->page.frame);
+		MEM_UNDEFINED(block->page.frame, srv_page_size);
+		mysql_mutex_lock(&buf_pool.mutex);
+	}
+
 #ifdef BTR_CUR_HASH_ADAPT
 	if (block->index) {
 		mysql_mutex_unlock(&buf_pool.mutex);
@@ -35,6 +35,7 @@ Created 11/5/1995 Heikki Tuuri
 #include "buf0lru.h"
 #include "buf0buddy.h"
 #include "buf0dblwr.h"
+#include "buf0tier.h"
 #include "page0zip.h"
 #include "log0recv.h"
 #include "trx0sys.h"
@@ -195,6 +196,41 @@ static buf_page_t *buf_page_init_for_read(const page_id_t page_id,
   return bpage;
 }
 
+/** Try to fill in a page from buf_tier instead of reading it.
+@param space   tablespace
+@param bpage   read-fixed uncompressed page
+@return error code of buf_page_t::read_complete()
+@retval DB_SUCCESS_LOCKED_REC if the page must be read from the file */
+static dberr_t buf_read_from_tier(fil_space_t *space, buf_page_t *bpage)
+{
+  ut_ad(bpage->is_read_fixed());
+  ut_ad(!bpage->zip.data);
+  const page_id_t id{bpage->id()};
+
+  /* buf_page_t::read_complete() would attempt to decrypt or
+  decompress the page frame that we would copy from buf_tier. */
+  if (space->crypt_data || space->is_compressed())
+  {
+    buf_tier.exclude(id);
+    return DB_SUCCESS_LOCKED_REC;
+  }
+
+  if (!buf_tier.take(id, bpage->frame))
+    return DB_SUCCESS_LOCKED_REC;
+
+  /* buf_page_t::read_complete() would evict the page as corrupted.
+  The data file may be fine; read the page from it instead. */
+  const byte *frame= bpage->frame;
+  if (page_id_t(mach_read_from_4(frame + FIL_PAGE_SPACE_ID),
+                mach_read_from_4(frame + FIL_PAGE_OFFSET)) != id ||
+      buf_page_is_corrupted(false, frame, space->flags))
+    return DB_SUCCESS_LOCKED_REC;
+
+  dberr_t err= bpage->read_complete(*UT_LIST_GET_FIRST(space->chain));
+  space->release();
+  return err == DB_FAIL ? DB_PAGE_CORRUPTED : err;
+}
+
 /** Low-level function which reads a page asynchronously from a file to the
 buffer buf_pool if it is not already there, in which case does nothing.
 Sets the io_fix flag and sets an exclusive lock on the buffer frame. The
@@ -235,6 +271,14 @@ buf_read_page_low(
 	}
 
 	ut_ad(bpage->in_file());
+
+	if (!zip_size) {
+		dberr_t err = buf_read_from_tier(space, bpage);
+		if (err != DB_SUCCESS_LOCKED_REC) {
+			return err;
+		}
+	}
+
 	ulonglong mariadb_timer= 0;
 
 	if (sync) {
@@ -289,6 +333,123 @@ static void buf_read_release(buf_block_t *block)
   }
 }
 
+/** Submit a read of adjacent pages that were registered by
+buf_page_init_for_read().
+@param space   tablespace with a single data file
+@param bpages  read-fixed pages in ascending order of page number
+@param n       number of pages */
+static void buf_read_submit(fil_space_t *space, buf_page_t *const *bpages,
+                            size_t n)
+{
+  ut_ad(n);
+  const page_id_t id{bpages[0]->id()};
+  fil_node_t *const node= UT_LIST_GET_FIRST(space->chain);
+  buf_page_t **batch= n > 1
+    ? static_cast<buf_page_t**>(ut_malloc_nokey(n * sizeof *bpages))
+    : nullptr;
+
+  if (UNIV_LIKELY(batch != nullptr))
+  {
+    memcpy(batch, bpages, n * sizeof *bpages);
+    srv_stats.data_read.add(n << srv_page_size_shift);
+    os_aio_read_pages(IORequest{*batch, nullptr, node,
+                                IORequest::READ_ASYNC},
+                      batch, n, os_offset_t{id.page_no()} <<
+                      srv_page_size_shift);
+    return;
+  }
+
+  for (size_t i= 0; i < n; i++)
+  {
+    buf_page_t *bpage= bpages[i];
+    auto fio= space->io(IORequest(IORequest::READ_ASYNC),
+                        os_offset_t{id.page_no() + i} << srv_page_size_shift,
+                        srv_page_size, bpage->frame, bpage);
+    if (UNIV_UNLIKELY(fio.err != DB_SUCCESS))
+      buf_pool.corrupted_evict(bpage, buf_page_t::READ_FIX);
+  }
+}
+
+/** Read the pages of a read-ahead area that are not in the buffer pool.
+Adjacent uncompressed pages of a single-file tablespace will be read
+with a single vectored read.
+@param space     tablespace
+@param low       first page to read
+@param high      end of the range of pages to read
+@param zip_size  ROW_FORMAT=COMPRESSED page size, or 0,
+                 bitwise-ORed with 1 in recovery
+@param block     preallocated buffer block
+@param ios       number of submitted read requests (incremented)
+@return number of pages that will be read */
+static ulint buf_read_ahead_pages(fil_space_t *space, page_id_t low,
+                                  const page_id_t high, ulint zip_size,
+                                  buf_block_t *&block, ulint &ios)
+{
+  ulint count= 0;
+#ifndef _WIN32
+  const fil_node_t *node= UT_LIST_GET_FIRST(space->chain);
+  if (!zip_size && !UT_LIST_GET_NEXT(chain, node) &&
+      high.page_no() <= node->size)
+  {
+    buf_page_t *bpages[buf_pool_t::READ_AHEAD_PAGES];
+    size_t n= 0;
+    for (; low < high; ++low)
+    {
+      if (space->is_stopping())
+        break;
+      buf_page_t *bpage= nullptr;
+      if (!buf_dblwr.is_inside(low))
+        bpage= buf_page_init_for_read(low, 0, buf_pool.page_hash.
+                                      cell_get(low.fold()), block);
+      if (!bpage)
+      {
+        /* Submit the pages that preceded this one. */
+        if (n)
+          buf_read_submit(space, bpages, n), ios++;
+        n= 0;
+        continue;
+      }
+      ut_ad(n < array_elements(bpages));
+      space->reacquire();
+      count++;
+      ut_ad(!block);
+      if (buf_read_from_tier(space, bpage) == DB_SUCCESS_LOCKED_REC)
+        bpages[n++]= bpage;
+      else if (n)
+      {
+        /* The page was not read; submit the pages that preceded it. */
+        buf_read_submit(space, bpages, n), ios++;
+        n= 0;
+      }
+      if (UNIV_UNLIKELY(!(block= buf_read_acquire())))
+        break;
+    }
+    if (n)
+      buf_read_submit(space, bpages, n), ios++;
+    return count;
+  }
+#endif
+
+  for (; low < high; ++low)
+  {
+    if (space->is_stopping())
+      break;
+    buf_pool_t::hash_chain &chain= buf_pool.page_hash.cell_get(low.fold());
+    space->reacquire();
+    if (buf_read_page_low(low, zip_size, chain, space, block) == DB_SUCCESS)
+    {
+      count++;
+      ios++;
+      ut_ad(!block);
+      if ((UNIV_LIKELY(!zip_size) || (zip_size & 1)) &&
+          UNIV_UNLIKELY(!(block= buf_read_acquire())))
+        break;
+    }
+  }
+
+  return count;
+}
+
 /** Applies a random read-ahead in buf_pool if there are at least a threshold
 value of accessed pages from the random read-ahead area. Does not read any
 page, not even the one at the position (space, offset), if the read-ahead
@@ -358,21 +519,8 @@ ulint buf_read_ahead_random(const page_id_t page_id, ulint zip_size)
     goto allocate_block;
   }
 
-  for (page_id_t i= low; i < high; ++i)
-  {
-    if (space->is_stopping())
-      break;
-    buf_pool_t::hash_chain &chain= buf_pool.page_hash.cell_get(i.fold());
-    space->reacquire();
-    if (buf_read_page_low(i, zip_size, chain, space, block) == DB_SUCCESS)
-    {
-      count++;
-      ut_ad(!block);
-      if ((UNIV_LIKELY(!zip_size) || (zip_size & 1)) &&
-          UNIV_UNLIKELY(!(block= buf_read_acquire())))
-        break;
-    }
-  }
+  ulint ios= 0;
+  count= buf_read_ahead_pages(space, low, high, zip_size, block, ios);
 
   if (count)
   {
@@ -384,6 +532,7 @@ ulint buf_read_ahead_random(const page_id_t page_id, ulint zip_size)
     LRU policy decision. */
     buf_LRU_stat_inc_io();
     buf_pool.stat.n_ra_pages_read_rnd+= count;
+    buf_pool.stat.n_ra_ios+= ios;
     mysql_mutex_unlock(&buf_pool.mutex);
   }
 
@@ -483,6 +632,43 @@ void buf_read_page_background(fil_space_t *space, const page_id_t page_id,
   can ignore these in our heuristics. */
 }
 
+/** Read a range of pages asynchronously for buffer pool load,
+skipping those that are already in the buffer pool. Adjacent pages will
+be read with a single vectored read where possible.
+@param space     tablespace (will be released by this function)
+@param low       first page to read
+@param high      end of the range of pages to read
+@param zip_size  ROW_FORMAT=COMPRESSED page size, or 0 */
+void buf_read_pages_background(fil_space_t *space, const page_id_t low,
+                               const page_id_t high, ulint zip_size)
+{
+  ut_ad(low < high);
+  ut_ad(high.page_no() - low.page_no() <= buf_pool_t::READ_AHEAD_PAGES);
+
+  buf_block_t *block= nullptr;
+  if (UNIV_LIKELY(!zip_size))
+  {
+  allocate_block:
+    if (UNIV_UNLIKELY(!(block= buf_read_acquire())))
+    {
+      space->release();
+      return;
+    }
+  }
+  else if (recv_recovery_is_on())
+  {
+    zip_size|= 1;
+    goto allocate_block;
+  }
+
+  ulint ios= 0;
+  buf_read_ahead_pages(space, low, high, zip_size, block, ios);
+  space->release();
+  buf_read_release(block);
+  /* As in buf_read_page_background(), these reads are not counted
+  for the LRU policy. */
+}
+
 /** Applies linear read-ahead if in the buf_pool the page is a border page of
 a linear read-ahead area and all the pages in the area have been accessed.
 Does not read any page if the read-ahead mechanism is not activated. Note
@@ -636,23 +822,9 @@ ulint buf_read_ahead_linear(const page_id_t page_id, ulint zip_size)
     goto allocate_block;
   }
 
-  count= 0;
-  for (; new_low <= new_high_1; ++new_low)
-  {
-    if (space->is_stopping())
-      break;
-    buf_pool_t::hash_chain &chain= buf_pool.page_hash.cell_get(new_low.fold());
-    space->reacquire();
-    if (buf_read_page_low(new_low, zip_size, chain, space, block) ==
-        DB_SUCCESS)
-    {
-      count++;
-      ut_ad(!block);
-      if ((UNIV_LIKELY(!zip_size) || (zip_size & 1)) &&
-          UNIV_UNLIKELY(!(block= buf_read_acquire())))
-        break;
-    }
-  }
+  ulint ios= 0;
+  count= buf_read_ahead_pages(space, new_low, new_high_1 + 1, zip_size,
+                              block, ios);
 
   if (count)
   {
@@ -664,6 +836,7 @@ ulint buf_read_ahead_linear(const page_id_t page_id, ulint zip_size)
     LRU policy decision. */
     buf_LRU_stat_inc_io();
     buf_pool.stat.n_ra_pages_read+= count;
+    buf_pool.stat.n_ra_ios+= ios;
     mysql_mutex_unlock(&buf_pool.mutex);
   }
 
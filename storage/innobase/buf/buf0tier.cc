@@ -0,0 +1,344 @@
+/*****************************************************************************
+
+Copyright (c) 2024, MariaDB Corporation.
+
+This program is free software; you can redistribute it and/or modify it under
+the terms of the GNU General Public License as published by the Free Software
+Foundation; version 2 of the License.
+
+This program is distributed in the hope that it will be useful, but WITHOUT
+ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License along with
+this program; if not, write to the Free Software Foundation, Inc.,
+51 Franklin Street, Fifth Floor, Boston, MA 02110-1335 USA
+
+*****************************************************************************/
+
+/**************************************************//**
+@file buf/buf0tier.cc
+Compressed in-memory cache of pages that were evicted from the buffer pool
+*******************************************************/
+
+#include "buf0tier.h"
+#include "fil0fil.h"
+#include "log0recv.h"
+#include "srv0srv.h"
+#include "zlib.h"
+#include "lz4.h"
+
+size_t srv_buf_pool_tier_size;
+
+buf_tier_t buf_tier;
+
+/** Do not cache pages that compress worse than this */
+static inline size_t buf_tier_max_len()
+{
+  return srv_page_size - (srv_page_size >> 3);
+}
+
+void buf_tier_t::create()
+{
+  for (shard &s : shards)
+  {
+    s.mutex.init();
+    UT_LIST_INIT(s.lru, &entry::lru_node);
+    s.size= 0;
+  }
+  last_seq= 0;
+  size= 0;
+}
+
+inline void buf_tier_t::shard::remove(entry *e, Atomic_counter<size_t> &total)
+{
+  const size_t len= sizeof *e + e->len;
+  ut_ad(size >= len);
+  size-= len;
+  total-= len;
+  if (e->data)
+    UT_LIST_REMOVE(lru, e);
+  auto i= spaces.find(e->id.space());
+  ut_ad(i != spaces.end());
+  if (!--i->second)
+    spaces.erase(i);
+}
+
+void buf_tier_t::shard::remove(uint32_t space_id,
+                               Atomic_counter<size_t> &total)
+{
+  if (spaces.find(space_id) == spaces.end())
+    return;
+  for (auto i= map.begin(); i != map.end(); )
+  {
+    if (i->first.space() != space_id)
+      i++;
+    else
+    {
+      remove(i->second, total);
+      free(i->second);
+      i= map.erase(i);
+    }
+  }
+  ut_ad(spaces.find(space_id) == spaces.end());
+}
+
+inline void buf_tier_t::free(entry *e)
+{
+  ut_free(e->data);
+  ut_free(e);
+}
+
+void buf_tier_t::close()
+{
+  for (shard &s : shards)
+  {
+    s.mutex.wr_lock();
+    for (const auto &i : s.map)
+    {
+      s.remove(i.second, size);
+      free(i.second);
+    }
+    s.map.clear();
+    s.excluded.clear();
+    s.mutex.wr_unlock();
+    ut_ad(!s.size);
+    ut_ad(!UT_LIST_GET_LEN(s.lru));
+    ut_ad(s.spaces.empty());
+    s.mutex.destroy();
+  }
+  ut_ad(!size);
+}
+
+void buf_tier_t::evict(shard &s, size_t limit)
+{
+  limit/= N_SHARDS;
+  if (s.size <= limit)
+    return;
+  s.mutex.wr_lock();
+  while (s.size > limit)
+  {
+    entry *e= UT_LIST_GET_LAST(s.lru);
+    if (!e)
+      break; /* only reservations are left */
+    s.map.erase(e->id);
+    s.remove(e, size);
+    free(e);
+  }
+  s.mutex.wr_unlock();
+}
+
+void buf_tier_t::evict(size_t limit)
+{
+  for (shard &s : shards)
+    evict(s, limit);
+}
+
+uint64_t buf_tier_t::reserve(const page_id_t id, const byte *frame)
+{
+  if (!srv_buf_pool_tier_size || id.space() == SRV_TMP_SPACE_ID ||
+      recv_recovery_is_on())
+    return 0;
+
+  entry *e= static_cast<entry*>(ut_malloc_nokey(sizeof *e));
+  if (!e)
+    return 0;
+  e->id= id;
+  e->data= nullptr;
+  e->len= 0;
+  e->lz4= false;
+  memcpy(e->hdr, frame + FIL_PAGE_OFFSET, 4);
+  memcpy(e->hdr + 4, frame + FIL_PAGE_ARCH_LOG_NO_OR_SPACE_ID, 4);
+
+  shard &s= get_shard(id);
+  s.mutex.wr_lock();
+  if (s.excluded.find(id.space()) != s.excluded.end())
+  {
+    s.mutex.wr_unlock();
+    ut_free(e);
+    return 0;
+  }
+  e->seq= ++last_seq;
+  auto i= s.map.emplace(id, e);
+  if (!i.second)
+  {
+    /* The page was read into buf_pool.page_hash without take(),
+    for example during crash recovery. Replace the stale entry. */
+    s.remove(i.first->second, size);
+    free(i.first->second);
+    i.first->second= e;
+  }
+  s.spaces[id.space()]++;
+  s.size+= sizeof *e;
+  size+= sizeof *e;
+  s.mutex.wr_unlock();
+  return e->seq;
+}
+
+void buf_tier_t::fill(const page_id_t id, uint64_t seq, const byte *frame)
+{
+  ut_ad(seq);
+  const size_t max_len= buf_tier_max_len();
+  byte *data= static_cast<byte*>(ut_malloc_nokey(max_len));
+  size_t len= 0;
+  bool lz4= false;
+
+  if (!data);
+  else if (provider_service_lz4->is_loaded)
+  {
+    int l= LZ4_compress_default(reinterpret_cast<const char*>(frame),
+                                reinterpret_cast<char*>(data),
+                                int(srv_page_size), int(max_len));
+    if (l > 0)
+    {
+      len= size_t(l);
+      lz4= true;
+    }
+  }
+  else
+  {
+    uLong l= uLong(max_len);
+    if (compress2(data, &l, frame, uLong(srv_page_size), Z_BEST_SPEED) ==
+        Z_OK)
+      len= size_t(l);
+  }
+
+  if (len)
+    if (byte *d= static_cast<byte*>(ut_realloc(data, len)))
+      data= d;
+
+  shard &s= get_shard(id);
+  s.mutex.wr_lock();
+  auto i= s.map.find(id);
+  if (i == s.map.end() || i->second->seq != seq)
+    /* The reservation was removed by take() or invalidate() */;
+  else if (!len)
+  {
+    s.remove(i->second, size);
+    free(i->second);
+    s.map.erase(i);
+  }
+  else
+  {
+    entry *e= i->second;
+    ut_ad(!e->data);
+    e->data= data;
+    e->len= uint32_t(len);
+    e->lz4= lz4;
+    s.size+= len;
+    size+= len;
+    UT_LIST_ADD_FIRST(s.lru, e);
+    data= nullptr;
+  }
+  s.mutex.wr_unlock();
+
+  ut_free(data);
+  evict(s, srv_buf_pool_tier_size);
+}
+
+bool buf_tier_t::take(const page_id_t id, byte *frame)
+{
+  if (!size)
+  {
+    if (srv_buf_pool_tier_size)
+      misses++;
+    return false;
+  }
+
+  shard &s= get_shard(id);
+  s.mutex.wr_lock();
+  auto i= s.map.find(id);
+  if (i == s.map.end())
+  {
+    s.mutex.wr_unlock();
+    misses++;
+    return false;
+  }
+
+  entry *e= i->second;
+  s.map.erase(i);
+  s.remove(e, size);
+  s.mutex.wr_unlock();
+
+  /* The entry is no longer reachable; decompress it without the latch. */
+  bool hit= false;
+
+  if (!e->data);
+  else if (e->lz4)
+    hit= LZ4_decompress_safe(reinterpret_cast<const char*>(e->data),
+                             reinterpret_cast<char*>(frame), int(e->len),
+                             int(srv_page_size)) == int(srv_page_size);
+  else
+  {
+    uLong l= uLong(srv_page_size);
+    hit= uncompress(frame, &l, e->data, e->len) == Z_OK &&
+      l == srv_page_size;
+  }
+
+  if (hit)
+  {
+    memcpy(frame + FIL_PAGE_OFFSET, e->hdr, 4);
+    memcpy(frame + FIL_PAGE_ARCH_LOG_NO_OR_SPACE_ID, e->hdr + 4, 4);
+    hits++;
+  }
+  else
+    misses++;
+
+  free(e);
+  return hit;
+}
+
+void buf_tier_t::invalidate_low(const page_id_t id)
+{
+  shard &s= get_shard(id);
+  s.mutex.wr_lock();
+  auto i= s.map.find(id);
+  if (i != s.map.end())
+  {
+    s.remove(i->second, size);
+    free(i->second);
+    s.map.erase(i);
+  }
+  s.mutex.wr_unlock();
+}
+
+void buf_tier_t::invalidate(uint32_t space_id)
+{
+  if (!size && !srv_buf_pool_tier_size)
+    return;
+  for (shard &s : shards)
+  {
+    s.mutex.wr_lock();
+    s.excluded.erase(space_id);
+    s.remove(space_id, size);
+    s.mutex.wr_unlock();
+  }
+}
+
+void buf_tier_t::exclude(uint32_t space_id)
+{
+  for (shard &s : shards)
+  {
+    s.mutex.wr_lock();
+    if (s.excluded.insert(space_id).second)
+      s.remove(space_id, size);
+    s.mutex.wr_unlock();
+  }
+}
+
+void buf_tier_t::exclude_low(const page_id_t id)
+{
+  shard &s= get_shard(id);
+  s.mutex.wr_lock();
+  const bool excluded= s.excluded.find(id.space()) != s.excluded.end();
+  auto i= s.map.find(id);
+  if (i != s.map.end())
+  {
+    s.remove(i->second, size);
+    free(i->second);
+    s.map.erase(i);
+  }
+  s.mutex.wr_unlock();
+  if (!excluded)
+    exclude(id.space());
+}
@@ -46,6 +46,7 @@ Created 10/25/1995 Heikki Tuuri
 #include "trx0purge.h"
 #include "buf0lru.h"
 #include "buf0flu.h"
+#include "buf0tier.h"
 #include "log.h"
 #ifdef __linux__
 # include <sys/types.h>
@@ -906,6 +907,7 @@ fil_space_free_low(
 	ut_ad(space->size == 0);
 
 	fil_space_destroy_crypt_data(&space->crypt_data);
+	buf_tier.invalidate(space->id);
 
 	space->~fil_space_t();
 	ut_free(space);
@@ -990,6 +992,8 @@ fil_space_t *fil_space_t::create(uint32_t id, uint32_t flags,
 	space= new (ut_zalloc_nokey(sizeof(*space))) fil_space_t;
 
 	space->id = id;
+	/* Discard any pages of a previous tablespace with the same id. */
+	buf_tier.invalidate(id);
 
 	UT_LIST_INIT(space->chain, &fil_node_t::chain);
 
@@ -999,6 +1003,10 @@ fil_space_t *fil_space_t::create(uint32_t id, uint32_t flags,
 	space->crypt_data = crypt_data;
 	space->n_pending.store(CLOSING, std::memory_order_relaxed);
 
+	if (srv_buf_pool_tier_size && (crypt_data || space->is_compressed())) {
+		buf_tier.exclude(id);
+	}
+
 	DBUG_LOG("tablespace", "Created metadata for " << id);
 	if (crypt_data) {
 		DBUG_LOG("crypt",
@@ -1446,6 +1454,13 @@ ATTRIBUTE_COLD void fil_space_t::reopen_all()
                                          OS_FILE_AIO, type,
                                          srv_read_only_mode, &success);
             ut_a(success);
+#ifdef HAVE_RWF_ATOMIC
+            /* Without O_DIRECT, writes with RWF_ATOMIC would fail. */
+            if (node->rwf_atomic &&
+                !my_test_if_rwf_atomic(node->handle, space.physical_size()) &&
+                !DBUG_IF("ib_simulate_rwf_atomic"))
+              node->atomic_write= node->rwf_atomic= false;
+#endif
             goto next_file;
           }
         }
@@ -75,6 +75,7 @@ this program; if not, write to the Free Software Foundation, Inc.,
 #include "buf0buf.h"
 #include "buf0flu.h"
 #include "buf0lru.h"
+#include "buf0tier.h"
 #include "dict0boot.h"
 #include "dict0load.h"
 #include "dict0crea.h"
@@ -871,6 +872,11 @@ static MYSQL_THDVAR_UINT(lock_wait_timeout, PLUGIN_VAR_RQCMDARG,
   "Timeout in seconds an InnoDB transaction may wait for a lock before being rolled back. The value 100000000 is infinite timeout.",
   NULL, NULL, 50, 0, 100000000, 0);
 
+static MYSQL_THDVAR_UINT(parallel_read_threads, PLUGIN_VAR_RQCMDARG,
+  "Number of threads that count the rows of a table for SELECT COUNT(*)."
+  " 1 disables the parallel count.",
+  NULL, NULL, 1, 1, 256, 0);
+
 static MYSQL_THDVAR_STR(ft_user_stopword_table,
   PLUGIN_VAR_OPCMDARG|PLUGIN_VAR_MEMALLOC,
   "User supplied stopword table name, effective in the session level.",
@@ -927,13 +933,20 @@ static SHOW_VAR innodb_status_variables[]= {
   {"buffer_pool_read_ahead", &buf_pool.stat.n_ra_pages_read, SHOW_SIZE_T},
   {"buffer_pool_read_ahead_evicted",
    &buf_pool.stat.n_ra_pages_evicted, SHOW_SIZE_T},
+  {"buffer_pool_read_ahead_ios", &buf_pool.stat.n_ra_ios, SHOW_SIZE_T},
   {"buffer_pool_read_requests",
    &export_vars.innodb_buffer_pool_read_requests, SHOW_SIZE_T},
   {"buffer_pool_reads", &buf_pool.stat.n_pages_read, SHOW_SIZE_T},
   {"buffer_pool_wait_free", &buf_pool.stat.LRU_waits, SHOW_SIZE_T},
   {"buffer_pool_write_requests", &buf_pool.flush_list_requests, SHOW_SIZE_T},
+  {"buffer_pool_tier_bytes", &buf_tier.size, SHOW_SIZE_T},
+  {"buffer_pool_tier_hits", &buf_tier.hits, SHOW_SIZE_T},
+  {"buffer_pool_tier_misses", &buf_tier.misses, SHOW_SIZE_T},
   {"checkpoint_age", &export_vars.innodb_checkpoint_age, SHOW_SIZE_T},
   {"checkpoint_max_age", &export_vars.innodb_checkpoint_max_age, SHOW_SIZE_T},
+#ifdef HAVE_RWF_ATOMIC
+  {"data_atomic_writes", (size_t*) &os_n_atomic_writes, SHOW_SIZE_T},
+#endif
   {"data_fsyncs", (size_t*) &os_n_fsyncs, SHOW_SIZE_T},
   {"data_pending_fsyncs",
    (size_t*) &fil_n_pending_tablespace_flushes, SHOW_SIZE_T},
@@ -966,6 +979,10 @@ static SHOW_VAR innodb_status_variables[]= {
   {"pages_created", &buf_pool.stat.n_pages_created, SHOW_SIZE_T},
   {"pages_read", &buf_pool.stat.n_pages_read, SHOW_SIZE_T},
   {"pages_written", &buf_pool.stat.n_pages_written, SHOW_SIZE_T},
+#ifdef UNIV_DEBUG
+  {"parallel_count_tasks", (size_t*) &row_count_parallel_tasks, SHOW_SIZE_T},
+  {"read_view_snapshots", (size_t*) &read_view_snapshots, SHOW_SIZE_T},
+#endif /* UNIV_DEBUG */
   {"row_lock_current_waits", &export_vars.innodb_row_lock_current_waits,
    SHOW_SIZE_T},
   {"row_lock_time", &export_vars.innodb_row_lock_time, SHOW_LONGLONG},
@@ -4981,6 +4998,15 @@ ha_innobase::table_flags() const
 	/* Need to use tx_isolation here since table flags is (also)
 	called before prebuilt is inited. */
 
+	/* Let records() count a table with several threads when
+COUNT(*) of a SELECT can be resolved without a full scan.
+EXPLAIN must not count the table during optimization. */
+	if (THDVAR(thd, parallel_read_threads) > 1
+	    && thd_sql_command(thd) == SQLCOM_SELECT
+	    && !thd_is_explain(thd)) {
+		flags |= HA_HAS_RECORDS;
+	}
+
 	if (thd_tx_isolation(thd) <= ISO_READ_COMMITTED) {
 		return(flags);
 	}
@@ -14355,6 +14381,52 @@ ha_innobase::records_in_range(
 	DBUG_RETURN((ha_rows) n_rows);
 }
 
+/** Count the rows of the table in the read view of the transaction,
+with innodb_parallel_read_threads threads.
+@return exact number of rows
+@retval HA_POS_ERROR if the rows cannot be counted this way */
+ha_rows ha_innobase::records()
+{
+	if (!(ha_table_flags() & HA_HAS_RECORDS)) {
+		return handler::records();
+	}
+
+	DBUG_ENTER("ha_innobase::records");
+
+	update_thd(ha_thd());
+
+	dict_table_t*	table = m_prebuilt->table;
+
+	if (m_prebuilt->select_lock_type != LOCK_NONE
+	    || table->is_temporary() || table->no_rollback()
+	    || !table->is_readable()
+	    || dict_table_get_first_index(table)->is_corrupted()
+	    || srv_read_only_mode
+	    || srv_force_recovery >= SRV_FORCE_NO_UNDO_LOG_SCAN) {
+		DBUG_RETURN(HA_POS_ERROR);
+	}
+
+	mariadb_set_stats set_stats_temporary(handler_stats);
+	trx_t*	trx = m_prebuilt->trx;
+
+	trx->op_info = "counting rows";
+
+	trx_start_if_not_started(trx, false);
+
+	if (trx->isolation_level > TRX_ISO_READ_UNCOMMITTED) {
+		trx->read_view.open(trx);
+	}
+
+	ulint	n_rows;
+	dberr_t	err = row_count_parallel(
+		m_prebuilt, THDVAR(m_user_thd, parallel_read_threads),
+		&n_rows);
+
+	trx->op_info = "";
+
+	DBUG_RETURN(err == DB_SUCCESS ? ha_rows(n_rows) : HA_POS_ERROR);
+}
+
 /*********************************************************************//**
 Gives an UPPER BOUND to the number of rows in a table. This is used in
 filesort.cc.
@@ -17472,6 +17544,16 @@ innodb_old_blocks_pct_update(THD*, st_mysql_sys_var*, void*, const void* save)
 	innobase_old_blocks_pct = ratio;
 }
 
+/** Update innodb_buffer_pool_tier_size */
+static void innodb_buffer_pool_tier_size_update(THD*, st_mysql_sys_var*,
+                                                void*, const void* save)
+{
+  srv_buf_pool_tier_size= *static_cast<const size_t*>(save);
+  mysql_mutex_unlock(&LOCK_global_system_variables);
+  buf_tier.resize();
+  mysql_mutex_lock(&LOCK_global_system_variables);
+}
+
 #ifdef UNIV_DEBUG
 static uint srv_fil_make_page_dirty_debug = 0;
 static uint srv_saved_page_number_debug;
@@ -18854,6 +18936,14 @@ static MYSQL_SYSVAR_ULONG(flush_log_at_trx_commit, srv_flush_log_at_trx_commit,
   " guarantees in case of crash. 0 and 2 can be faster than 1 or 3.",
   NULL, NULL, 1, 0, 3, 0);
 
+static MYSQL_SYSVAR_BOOL(log_write_async, srv_log_write_async,
+  PLUGIN_VAR_OPCMDARG,
+  "Whether a background task writes the redo log for committing"
+  " client transactions, instead of the client thread itself."
+  " With thread_handling=pool-of-threads, the worker thread can serve"
+  " other clients while the commit waits for the log write.",
+  NULL, NULL, FALSE);
+
 static MYSQL_SYSVAR_ENUM(flush_method, innodb_flush_method,
   PLUGIN_VAR_RQCMDARG | PLUGIN_VAR_READONLY | PLUGIN_VAR_DEPRECATED,
   "With which method to flush data.",
@@ -19063,6 +19153,12 @@ static MYSQL_SYSVAR_SIZE_T(lru_flush_size, innodb_lru_flush_size,
   "How many pages to flush on LRU eviction",
   NULL, NULL, 32, 1, SIZE_T_MAX, 0);
 
+static MYSQL_SYSVAR_SIZE_T(buffer_pool_tier_size, srv_buf_pool_tier_size,
+  PLUGIN_VAR_RQCMDARG,
+  "Maximum size in bytes of the compressed cache of pages evicted from"
+  " the buffer pool (0=disable)",
+  NULL, innodb_buffer_pool_tier_size_update, 0, 0, SIZE_T_MAX, 0);
+
 static MYSQL_SYSVAR_ULONG(flush_neighbors, srv_flush_neighbors,
   PLUGIN_VAR_OPCMDARG,
   "Set to 0 (don't flush neighbors from buffer pool),"
@@ -19383,6 +19479,12 @@ static MYSQL_SYSVAR_BOOL(use_native_aio, srv_use_native_aio,
   "Use native AIO if supported on this platform.",
   NULL, NULL, innodb_use_native_aio_default());
 
+static MYSQL_SYSVAR_BOOL(use_registered_buffers, srv_use_registered_buffers,
+  PLUGIN_VAR_NOCMDARG | PLUGIN_VAR_READONLY,
+  "Register the buffer pool with native AIO if supported on this platform."
+  " The buffer pool will be locked in memory, subject to RLIMIT_MEMLOCK.",
+  NULL, NULL, FALSE);
+
 #ifdef HAVE_LIBNUMA
 static MYSQL_SYSVAR_BOOL(numa_interleave, srv_numa_interleave,
   PLUGIN_VAR_NOCMDARG | PLUGIN_VAR_READONLY,
@@ -19636,6 +19738,7 @@ static struct st_mysql_sys_var* innobase_system_variables[]= {
   MYSQL_SYSVAR(buffer_pool_load_at_startup),
   MYSQL_SYSVAR(lru_scan_depth),
   MYSQL_SYSVAR(lru_flush_size),
+  MYSQL_SYSVAR(buffer_pool_tier_size),
   MYSQL_SYSVAR(flush_neighbors),
   MYSQL_SYSVAR(checksum_algorithm),
   MYSQL_SYSVAR(compression_level),
@@ -19651,6 +19754,7 @@ static struct st_mysql_sys_var* innobase_system_variables[]= {
   MYSQL_SYSVAR(file_per_table),
   MYSQL_SYSVAR(flush_log_at_timeout),
   MYSQL_SYSVAR(flush_log_at_trx_commit),
+  MYSQL_SYSVAR(log_write_async),
   MYSQL_SYSVAR(flush_method),
   MYSQL_SYSVAR(force_recovery),
   MYSQL_SYSVAR(fill_factor),
@@ -19663,6 +19767,7 @@ static struct st_mysql_sys_var* innobase_system_variables[]= {
   MYSQL_SYSVAR(ft_num_word_optimize),
   MYSQL_SYSVAR(ft_sort_pll_degree),
   MYSQL_SYSVAR(lock_wait_timeout),
+  MYSQL_SYSVAR(parallel_read_threads),
   MYSQL_SYSVAR(deadlock_detect),
   MYSQL_SYSVAR(deadlock_report),
   MYSQL_SYSVAR(page_size),
@@ -19717,6 +19822,7 @@ static struct st_mysql_sys_var* innobase_system_variables[]= {
   MYSQL_SYSVAR(tmpdir),
   MYSQL_SYSVAR(autoinc_lock_mode),
   MYSQL_SYSVAR(use_native_aio),
+  MYSQL_SYSVAR(use_registered_buffers),
 #ifdef HAVE_LIBNUMA
   MYSQL_SYSVAR(numa_interleave),
 #endif /* HAVE_LIBNUMA */
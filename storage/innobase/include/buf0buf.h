@@ -1137,6 +1137,8 @@ struct buf_pool_stat_t{
 	ulint	n_ra_pages_evicted;/*!< number of read ahead
 				pages that are evicted without
 				being accessed */
+	ulint	n_ra_ios;	/*!< number of read requests
+				submitted by read ahead */
 	ulint	n_pages_made_young; /*!< number of pages made young, in
 				buf_page_make_young() */
 	ulint	n_pages_not_made_young; /*!< number of pages not made
@@ -1257,6 +1259,13 @@ class buf_pool_t
   /** Clean up after successful create() */
   void close();
 
+  /** Register the buffer pool memory for asynchronous I/O, so that
+  io_uring need not map the page frames for each request.
+  This is only done if innodb_use_registered_buffers=ON and
+  RLIMIT_MEMLOCK allows the whole buffer pool to be pinned.
+  @param enable  false=unregister, true=register the current chunks */
+  void register_aio_buffers(bool enable) const;
+
   /** Resize from srv_buf_pool_old_size to srv_buf_pool_size. */
   inline void resize();
 
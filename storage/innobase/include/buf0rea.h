@@ -55,6 +55,18 @@ void buf_read_page_background(fil_space_t *space, const page_id_t page_id,
                               ulint zip_size)
   MY_ATTRIBUTE((nonnull));
 
+/** Read a range of pages asynchronously for buffer pool load,
+skipping those that are already in the buffer pool. Adjacent pages will
+be read with a single vectored read where possible.
+@param space     tablespace (will be released by this function)
+@param low       first page to read
+@param high      end of the range of pages to read; at most
+                 buf_pool_t::READ_AHEAD_PAGES after low
+@param zip_size  ROW_FORMAT=COMPRESSED page size, or 0 */
+void buf_read_pages_background(fil_space_t *space, const page_id_t low,
+                               const page_id_t high, ulint zip_size)
+  MY_ATTRIBUTE((nonnull));
+
 /** Applies a random read-ahead in buf_pool if there are at least a threshold
 value of accessed pages from the random read-ahead area. Does not read any
 page, not even the one at the position (space, offset), if the read-ahead
@@ -0,0 +1,205 @@
+/*****************************************************************************
+
+Copyright (c) 2024, MariaDB Corporation.
+
+This program is free software; you can redistribute it and/or modify it under
+the terms of the GNU General Public License as published by the Free Software
+Foundation; version 2 of the License.
+
+This program is distributed in the hope that it will be useful, but WITHOUT
+ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License along with
+this program; if not, write to the Free Software Foundation, Inc.,
+51 Franklin Street, Fifth Floor, Boston, MA 02110-1335 USA
+
+*****************************************************************************/
+
+/**************************************************//**
+@file include/buf0tier.h
+Compressed in-memory cache of pages that were evicted from the buffer pool
+*******************************************************/
+
+#pragma once
+
+#include "buf0types.h"
+#include "srw_lock.h"
+#include "ut0lst.h"
+#include <unordered_map>
+#include <unordered_set>
+
+/** Maximum size of buf_tier, in bytes (innodb_buffer_pool_tier_size);
+0 disables the cache */
+extern size_t srv_buf_pool_tier_size;
+
+/** A cache of compressed copies of clean pages that were evicted by
+buf_LRU_free_page(), consulted before a page is read from a data file.
+
+Consistency with the data files is maintained as follows. An entry is
+reserved by buf_LRU_free_page() while the page is still in
+buf_pool.page_hash and the exclusive page_hash latch is being held.
+Any read of the page must first register it in buf_pool.page_hash, and
+then take() the entry, which removes it. A page that is being created
+by buf_page_create() or whose tablespace is being created or removed is
+invalidate()d. Hence, any entry that is found is as current as the
+data file.
+
+The pages are partitioned into shards by page_id_t::fold(), each with
+its own latch, LRU list and share of srv_buf_pool_tier_size. */
+class buf_tier_t
+{
+  /** A compressed page */
+  struct entry
+  {
+    /** position in shard::lru, if data != nullptr */
+    UT_LIST_NODE_T(entry) lru_node;
+    /** page identifier */
+    page_id_t id;
+    /** reservation identifier */
+    uint64_t seq;
+    /** compressed page, or nullptr if the entry is only reserved */
+    byte *data;
+    /** length of data in bytes */
+    uint32_t len;
+    /** whether data is LZ4 (instead of zlib) compressed */
+    bool lz4;
+    /** the original FIL_PAGE_OFFSET and
+    FIL_PAGE_ARCH_LOG_NO_OR_SPACE_ID, which buf_LRU_block_remove_hashed()
+    will overwrite before the page is compressed */
+    byte hdr[8];
+  };
+
+  /** Hash function for page_id_t */
+  struct hasher
+  {
+    size_t operator()(const page_id_t id) const
+    { return std::hash<uint64_t>()(id.raw()); }
+  };
+
+  /** A partition of the cache */
+  struct alignas(CPU_LEVEL1_DCACHE_LINESIZE) shard
+  {
+    /** protects all members */
+    srw_mutex mutex;
+    /** the cached pages */
+    std::unordered_map<page_id_t, entry*, hasher> map;
+    /** compressed pages, least recently inserted last */
+    UT_LIST_BASE_NODE_T(entry) lru;
+    /** number of entries of each tablespace that has any */
+    std::unordered_map<uint32_t, size_t> spaces;
+    /** tablespaces whose pages must not be cached */
+    std::unordered_set<uint32_t> excluded;
+    /** memory used by the entries, in bytes */
+    size_t size;
+
+    /** Remove an entry from lru and from the accounting, but not from map.
+    @param e     entry
+    @param total buf_tier_t::size */
+    inline void remove(entry *e, Atomic_counter<size_t> &total);
+    /** Remove all entries of a tablespace.
+    @param space_id  tablespace identifier
+    @param total     buf_tier_t::size */
+    void remove(uint32_t space_id, Atomic_counter<size_t> &total);
+  };
+
+  /** number of shards */
+  static constexpr size_t N_SHARDS= 16;
+  /** the shards */
+  shard shards[N_SHARDS];
+  /** the most recently assigned entry::seq */
+  Atomic_counter<uint64_t> last_seq;
+
+  /** @return the shard of a page */
+  shard &get_shard(const page_id_t id)
+  { return shards[id.fold() % N_SHARDS]; }
+
+  /** Free an entry that has been removed. */
+  static inline void free(entry *e);
+  /** Evict least recently inserted pages of a shard until it fits
+  in its share of a limit.
+  @param s      shard
+  @param limit  maximum size of the whole cache in bytes */
+  void evict(shard &s, size_t limit);
+  /** Evict least recently inserted pages until the cache fits in a limit.
+  @param limit  maximum size in bytes */
+  void evict(size_t limit);
+
+public:
+  /** memory used by the compressed pages, in bytes */
+  Atomic_counter<size_t> size;
+  /** number of reads that were served from the cache */
+  Atomic_counter<size_t> hits;
+  /** number of reads that were not served from the cache */
+  Atomic_counter<size_t> misses;
+
+  /** Initialise the cache. */
+  void create();
+  /** Discard all pages and free the resources. */
+  void close();
+
+  /** Reserve an entry for a clean page that is being evicted.
+  The page must be in buf_pool.page_hash, with the exclusive latch held.
+  @param id     page identifier
+  @param frame  uncompressed page
+  @return reservation identifier for fill()
+  @retval 0 if the page will not be cached */
+  uint64_t reserve(const page_id_t id, const byte *frame);
+
+  /** Compress a page that was reserved by reserve() and removed from
+  buf_pool.page_hash.
+  @param id     page identifier
+  @param seq    return value of reserve()
+  @param frame  uncompressed page */
+  void fill(const page_id_t id, uint64_t seq, const byte *frame);
+
+  /** Look up a page and remove it from the cache.
+  The page must be read-fixed in buf_pool.page_hash.
+  @param id     page identifier
+  @param frame  buffer for the uncompressed page
+  @return whether frame was filled in */
+  bool take(const page_id_t id, byte *frame);
+
+  /** Remove a page from the cache.
+  @param id     page identifier */
+  void invalidate(const page_id_t id)
+  {
+    if (size)
+      invalidate_low(id);
+  }
+
+  /** Remove all pages of a tablespace from the cache, and allow its
+  pages to be cached again, for a tablespace that is being created or
+  removed.
+  @param space_id  tablespace identifier */
+  void invalidate(uint32_t space_id);
+
+  /** Stop caching the pages of a tablespace whose pages cannot be
+  served from the cache (encrypted or page_compressed), and remove the
+  pages of it that are in the cache.
+  @param space_id  tablespace identifier */
+  void exclude(uint32_t space_id);
+
+  /** Remove a page of a tablespace whose pages cannot be served from
+  the cache, and stop caching the tablespace unless that was done.
+  @param id     page identifier */
+  void exclude(const page_id_t id)
+  {
+    if (srv_buf_pool_tier_size)
+      exclude_low(id);
+  }
+
+  /** Apply a change of srv_buf_pool_tier_size. */
+  void resize() { evict(srv_buf_pool_tier_size); }
+
+private:
+  /** Remove a page from the cache.
+  @param id     page identifier */
+  void invalidate_low(const page_id_t id);
+  /** Remove a page, and stop caching its tablespace.
+  @param id     page identifier */
+  void exclude_low(const page_id_t id);
+};
+
+/** The compressed cache of evicted pages */
+extern buf_tier_t buf_tier;
@@ -234,20 +234,24 @@ typedef srw_lock log_rwlock_t;
   /** Buffer for writing to resize_log; @see flush_buf */
   byte *resize_flush_buf;
 
-  /** spin lock protecting lsn, buf_free in append_prepare() */
+  /** spin lock protecting lsn, buf_free in append_prepare() if is_pmem() */
   alignas(CPU_LEVEL1_DCACHE_LINESIZE) pthread_mutex_t lsn_lock;
   void init_lsn_lock() { pthread_mutex_init(&lsn_lock, LSN_LOCK_ATTR); }
   void lock_lsn() { pthread_mutex_lock(&lsn_lock); }
   void unlock_lsn() { pthread_mutex_unlock(&lsn_lock); }
   void destroy_lsn_lock() { pthread_mutex_destroy(&lsn_lock); }
 
-public:
-  /** first free offset within buf use; protected by lsn_lock */
+  /** if is_pmem(): first free offset within buf; protected by lsn_lock */
   Atomic_relaxed<size_t> buf_free;
-  /** number of write requests (to buf); protected by exclusive lsn_lock */
-  ulint write_to_buf;
-  /** number of waits in append_prepare(); protected by lsn_lock */
-  ulint waits;
+  /** if !is_pmem(): the LSN corresponding to buf[0], so that the first
+  free offset within buf is lsn - buf_lsn; protected by exclusive latch */
+  lsn_t buf_lsn;
+
+public:
+  /** number of write requests (to buf) */
+  Atomic_counter<ulint> write_to_buf;
+  /** number of waits in append_prepare() */
+  Atomic_counter<ulint> waits;
   /** recommended maximum size of buf, after which the buffer is flushed */
   size_t max_buf_free;
 
@@ -309,6 +313,18 @@ typedef srw_lock log_rwlock_t;
 
   bool is_initialised() const noexcept { return max_buf_free != 0; }
 
+  /** @return the first free offset within buf */
+  size_t get_buf_free() const noexcept
+  { return is_pmem() ? size_t{buf_free} : size_t(get_lsn() - buf_lsn); }
+  /** Set the first free offset within buf, corresponding to get_lsn().
+  The caller must hold exclusive latch or be the only thread
+  that is accessing the log. */
+  void set_buf_free(size_t offset) noexcept
+  {
+    buf_free= offset;
+    buf_lsn= get_lsn() - offset;
+  }
+
 #ifdef HAVE_PMEM
   bool is_pmem() const noexcept { return !flush_buf; }
 #else
@@ -444,8 +460,9 @@ typedef srw_lock log_rwlock_t;
 
 private:
   /** Wait in append_prepare() for buffer to become available
-  @param ex   whether log_sys.latch is exclusively locked */
-  ATTRIBUTE_COLD static void append_prepare_wait(bool ex) noexcept;
+  @param ex   whether log_sys.latch is exclusively locked
+  @param pmem whether lsn_lock is being held (log_sys.is_pmem()) */
+  ATTRIBUTE_COLD static void append_prepare_wait(bool ex, bool pmem) noexcept;
 public:
   /** Reserve space in the log buffer for appending data.
   @tparam pmem  log_sys.is_pmem()
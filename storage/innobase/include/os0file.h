@@ -266,6 +266,8 @@ constexpr ulint OS_AIO_N_PENDING_IOS_PER_THREAD= 256;
 
 extern Atomic_counter<ulint> os_n_file_reads;
 extern Atomic_counter<size_t> os_n_file_writes;
+/** number of page writes submitted with RWF_ATOMIC */
+extern Atomic_counter<size_t> os_n_atomic_writes;
 extern Atomic_counter<size_t> os_n_fsyncs;
 
 /* File types for directory entry data type */
@@ -1058,6 +1060,18 @@ void os_fake_read(const IORequest &type, os_offset_t offset);
 @retval DB_IO_ERROR on I/O error */
 dberr_t os_aio(const IORequest &type, void *buf, os_offset_t offset, size_t n);
 
+#ifndef _WIN32
+/** Submit an asynchronous read of adjacent uncompressed pages, to be
+executed as a single vectored read in the thread pool.
+@param type     I/O request for the first page
+@param bpages   read-fixed pages in ascending order of page number,
+                allocated by ut_malloc(); will be freed on completion
+@param n        number of pages
+@param offset   file offset of the first page */
+void os_aio_read_pages(const IORequest &type, buf_page_t **bpages, size_t n,
+                       os_offset_t offset);
+#endif
+
 /** @return number of pending reads */
 size_t os_aio_pending_reads();
 /** @return approximate number of pending reads */
@@ -1073,6 +1087,11 @@ void os_aio_wait_until_no_pending_writes(bool declare);
 @param declare  whether the wait will be declared in tpool */
 void os_aio_wait_until_no_pending_reads(bool declare);
 
+/** Change the maximum number of concurrently executing read completion
+callbacks. The number of pending reads is not affected.
+@param n  maximum number of concurrent read completion callbacks */
+void os_aio_set_read_concurrency(uint n);
+
 /** Prints info of the aio arrays.
 @param[in/out]	file		file where to print */
 void
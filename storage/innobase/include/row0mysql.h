@@ -440,7 +440,14 @@ struct mysql_row_templ_t {
 	ulint	is_virtual;		/*!< if a column is a virtual column */
 };
 
-#define MYSQL_FETCH_CACHE_SIZE		8
+/* Maximum number of rows in fetch_cache */
+#define MYSQL_FETCH_CACHE_SIZE		256
+/* Number of rows in the first prefetch batch; subsequent batches of
+the same cursor grow with the number of rows fetched, so that small
+LIMIT queries do not pay for converting rows that will not be read */
+#define MYSQL_FETCH_CACHE_MIN_SIZE	8
+/* Upper limit of the memory reserved for fetch_cache, in bytes */
+#define MYSQL_FETCH_CACHE_MAX_BYTES	(64U << 10)
 /* After fetching this many rows, we start caching them in fetch_cache */
 #define MYSQL_FETCH_CACHE_THRESHOLD	4
 
@@ -625,7 +632,9 @@ struct row_prebuilt_t {
 					pointers point 4 bytes past the
 					allocated mem buf start, because
 					there is a 4 byte magic number at the
-					start and at the end */
+					start and at the end; only the first
+					fetch_cache_size() elements are
+					allocated */
 	bool		keep_other_fields_on_keyread; /*!< when using fetch
 					cache with HA_EXTRA_KEYREAD, don't
 					overwrite other fields in mysql row
@@ -634,6 +643,22 @@ struct row_prebuilt_t {
 					fetched row in fetch_cache */
 	ulint		n_fetch_cached;	/*!< number of not yet fetched rows
 					in fetch_cache */
+	/** @return the number of rows that fit in fetch_cache */
+	ulint fetch_cache_size() const
+	{
+		return std::max<ulint>(
+			MYSQL_FETCH_CACHE_MIN_SIZE,
+			std::min<ulint>(MYSQL_FETCH_CACHE_SIZE,
+					MYSQL_FETCH_CACHE_MAX_BYTES
+					/ (mysql_row_len + 8)));
+	}
+	/** @return the number of rows to buffer in the current batch */
+	ulint fetch_cache_limit() const
+	{
+		return std::min(fetch_cache_size(),
+				std::max<ulint>(MYSQL_FETCH_CACHE_MIN_SIZE,
+						n_rows_fetched));
+	}
 	mem_heap_t*	blob_heap;	/*!< in SELECTS BLOB fields are copied
 					to this heap */
 	mem_heap_t*	old_vers_heap;	/*!< memory heap where a previous
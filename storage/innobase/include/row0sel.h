@@ -178,6 +178,21 @@ current read view.
 dberr_t row_check_index(row_prebuilt_t *prebuilt, ulint *n_rows)
   MY_ATTRIBUTE((nonnull, warn_unused_result));
 
+/** Count the records of the clustered index that are visible in the
+read view of the transaction, with several threads.
+@param prebuilt   table and transaction
+@param n_threads  maximum number of threads
+@param n_rows     number of records counted
+@return error code */
+dberr_t row_count_parallel(row_prebuilt_t *prebuilt, ulint n_threads,
+                           ulint *n_rows)
+  MY_ATTRIBUTE((nonnull, warn_unused_result));
+
+#ifdef UNIV_DEBUG
+/** Number of tasks that row_count_parallel() has submitted */
+extern Atomic_counter<size_t> row_count_parallel_tasks;
+#endif /* UNIV_DEBUG */
+
 /** Read the max AUTOINC value from an index.
 @param[in] index	index starting with an AUTO_INCREMENT column
 @return	the largest AUTO_INCREMENT value
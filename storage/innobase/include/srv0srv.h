@@ -182,6 +182,9 @@ OS (provided we compiled Innobase with it in), otherwise we will
 use simulated aio.
 Currently we support native aio on windows and linux */
 extern my_bool	srv_use_native_aio;
+/** innodb_use_registered_buffers: whether to register the buffer pool
+with the asynchronous I/O subsystem (pinning it in memory) */
+extern my_bool	srv_use_registered_buffers;
 extern my_bool	srv_numa_interleave;
 
 /* Use atomic writes i.e disable doublewrite buffer */
@@ -226,6 +229,7 @@ extern char*	srv_log_group_home_dir;
 at startup (while disallowing writes to the redo log). */
 extern ulonglong	srv_log_file_size;
 extern ulong	srv_flush_log_at_trx_commit;
+extern my_bool	srv_log_write_async;
 extern uint	srv_flush_log_at_timeout;
 extern my_bool	srv_adaptive_flushing;
 extern my_bool	srv_flush_sync;
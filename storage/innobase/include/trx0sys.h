@@ -871,6 +871,27 @@ class trx_sys_t
   std::atomic<trx_id_t> m_rw_trx_hash_version;
 
 
+  /**
+    Number of deregister_rw() calls. Together with m_max_trx_id, this
+    identifies the contents of rw_trx_hash that snapshot_ids() observes:
+    register_rw() and assign_new_trx_no() increment m_max_trx_id.
+
+    @sa snapshot_from_cache()
+  */
+  alignas(CPU_LEVEL1_DCACHE_LINESIZE)
+  std::atomic<uint64_t> m_rw_trx_hash_erased;
+
+
+  /** Protects m_snapshot, m_snapshot_max_trx_id, m_snapshot_erased */
+  alignas(CPU_LEVEL1_DCACHE_LINESIZE) srw_spin_lock_low m_snapshot_latch;
+  /** m_max_trx_id when m_snapshot was created; TRX_ID_MAX if none */
+  trx_id_t m_snapshot_max_trx_id;
+  /** m_rw_trx_hash_erased when m_snapshot was created */
+  uint64_t m_snapshot_erased;
+  /** The most recently created MVCC snapshot */
+  ReadViewBase m_snapshot;
+
+
   bool m_initialised;
 
   /** False if there is no undo log to purge or rollback */
@@ -1130,6 +1151,61 @@ class trx_sys_t
   void deregister_rw(trx_t *trx)
   {
     rw_trx_hash.erase(trx);
+    m_rw_trx_hash_erased.fetch_add(1, std::memory_order_release);
+  }
+
+
+  /** @return the number of deregister_rw() calls so far */
+  uint64_t get_rw_trx_hash_erased() const
+  {
+    return m_rw_trx_hash_erased.load(std::memory_order_acquire);
+  }
+
+
+  /**
+    Copy the most recently created MVCC snapshot, if no transaction has
+    been registered, assigned a serialisation number or deregistered since
+    it was created. This avoids iterating rw_trx_hash and sorting the
+    identifiers when many read views are being created between commits.
+
+    @param[out] view    the snapshot
+    @param      erased  get_rw_trx_hash_erased(), read before this call
+    @return whether view was assigned
+  */
+  bool snapshot_from_cache(ReadViewBase *view, uint64_t erased)
+  {
+    const trx_id_t max_trx_id= get_max_trx_id();
+    if (max_trx_id != m_rw_trx_hash_version.load(std::memory_order_acquire))
+      return false;
+    m_snapshot_latch.rd_lock();
+    const bool hit= m_snapshot_max_trx_id == max_trx_id &&
+      m_snapshot_erased == erased;
+    if (hit)
+      *view= m_snapshot;
+    m_snapshot_latch.rd_unlock();
+    return hit;
+  }
+
+
+  /**
+    Remember a newly created MVCC snapshot for snapshot_from_cache().
+    @param view        the snapshot
+    @param erased      get_rw_trx_hash_erased() before snapshot_ids()
+    @param max_trx_id  the max_trx_id that snapshot_ids() returned
+  */
+  void snapshot_to_cache(const ReadViewBase &view, uint64_t erased,
+                         trx_id_t max_trx_id)
+  {
+    /* Never wait here; another thread may be doing the same. */
+    if (!m_snapshot_latch.wr_lock_try())
+      return;
+    if (m_snapshot_max_trx_id != max_trx_id || m_snapshot_erased != erased)
+    {
+      m_snapshot= view;
+      m_snapshot_max_trx_id= max_trx_id;
+      m_snapshot_erased= erased;
+    }
+    m_snapshot_latch.wr_unlock();
   }
 
 
@@ -1271,3 +1347,9 @@ class trx_sys_t
 
 /** The transaction system */
 extern trx_sys_t trx_sys;
+
+#ifdef UNIV_DEBUG
+/** Number of MVCC snapshots that were not copied from
+trx_sys_t::snapshot_from_cache() */
+extern Atomic_counter<size_t> read_view_snapshots;
+#endif /* UNIV_DEBUG */
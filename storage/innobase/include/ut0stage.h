@@ -110,6 +110,14 @@ class ut_stage_alter_t {
 	inc(
 		ulint	inc_val = 1);
 
+	/** Flag many records processed at once during the sort phase.
+	This is used for a merge sort that was executed in a background
+	task, which cannot update the progress while it is running.
+	@param[in]	n_recs	number of records that were processed */
+	void
+	inc_sorted(
+		ulint	n_recs);
+
 	/** Flag the end of reading of the primary key.
 	Here we know the exact number of pages and records and calculate
 	the number of records per page and refresh the estimate. */
@@ -314,6 +322,36 @@ ut_stage_alter_t::inc(ulint inc_val)
 	}
 }
 
+/** Flag many records processed at once during the sort phase.
+@param[in]	n_recs	number of records that were processed */
+inline
+void
+ut_stage_alter_t::inc_sorted(ulint n_recs)
+{
+	if (m_progress == NULL) {
+		return;
+	}
+
+	ut_ad(m_cur_phase == SORT);
+
+	/* inc() would report one unit of work every this many records */
+	const double	every_nth = m_n_recs_per_page
+		* static_cast<double>(m_sort_multi_factor);
+
+	const ulint	before = static_cast<ulint>(
+		ceil(static_cast<double>(m_n_recs_processed) / every_nth));
+
+	m_n_recs_processed += n_recs;
+
+	const ulint	after = static_cast<ulint>(
+		ceil(static_cast<double>(m_n_recs_processed) / every_nth));
+
+	if (after > before) {
+		mysql_stage_inc_work_completed(m_progress, after - before);
+		reestimate();
+	}
+}
+
 /** Flag the end of reading of the primary key.
 Here we know the exact number of pages and records and calculate
 the number of records per page and refresh the estimate. */
@@ -480,6 +518,7 @@ class ut_stage_alter_t {
 
 	void inc() {}
 	void inc(ulint) {}
+	void inc_sorted(ulint) {}
 
 	void end_phase_read_pk() {}
 
@@ -849,6 +849,27 @@ lock_rec_get_prev(
 
 /*============= FUNCTIONS FOR ANALYZING RECORD LOCK QUEUE ================*/
 
+/** Check if a record lock is a GRANTED explicit lock of a transaction
+that is stronger or equal to precise_mode.
+@param lock          record lock on heap_no
+@param precise_mode  LOCK_S or LOCK_X possibly ORed to LOCK_GAP or
+LOCK_REC_NOT_GAP; for a supremum record we regard this always a gap
+type request
+@param heap_no       heap number of the record
+@param trx           transaction
+@return whether lock is such a lock */
+static inline bool lock_rec_is_expl(const lock_t *lock, ulint precise_mode,
+                                    ulint heap_no, const trx_t *trx)
+{
+  return lock->trx == trx &&
+    !(lock->type_mode & (LOCK_WAIT | LOCK_INSERT_INTENTION)) &&
+    (!((LOCK_REC_NOT_GAP | LOCK_GAP) & lock->type_mode) ||
+     heap_no == PAGE_HEAP_NO_SUPREMUM ||
+     ((LOCK_REC_NOT_GAP | LOCK_GAP) & precise_mode & lock->type_mode)) &&
+    lock_mode_stronger_or_eq(lock->mode(), static_cast<lock_mode>
+                             (precise_mode & LOCK_MODE_MASK));
+}
+
 /*********************************************************************//**
 Checks if a transaction has a GRANTED explicit lock on rec stronger or equal
 to precise_mode.
@@ -873,13 +894,7 @@ lock_rec_has_expl(
 
   for (lock_t *lock= lock_sys_t::get_first(cell, id, heap_no); lock;
        lock= lock_rec_get_next(heap_no, lock))
-    if (lock->trx == trx &&
-	!(lock->type_mode & (LOCK_WAIT | LOCK_INSERT_INTENTION)) &&
-	(!((LOCK_REC_NOT_GAP | LOCK_GAP) & lock->type_mode) ||
-	 heap_no == PAGE_HEAP_NO_SUPREMUM ||
-	 ((LOCK_REC_NOT_GAP | LOCK_GAP) & precise_mode & lock->type_mode)) &&
-	lock_mode_stronger_or_eq(lock->mode(), static_cast<lock_mode>
-				 (precise_mode & LOCK_MODE_MASK)))
+    if (lock_rec_is_expl(lock, precise_mode, heap_no, trx))
       return lock;
 
   return nullptr;
@@ -1041,6 +1056,65 @@ static lock_t *lock_rec_other_has_conflicting(unsigned mode,
 	return(NULL);
 }
 
+/** Find a sufficient lock that a transaction already holds on a record,
+or else the first lock of another transaction that a new lock request
+would have to wait for. This is equivalent to lock_rec_has_expl()
+followed by lock_rec_other_has_conflicting(), but the lock queue of a
+frequently locked record is traversed only once.
+@param mode          requested lock mode, see lock_rec_other_has_conflicting()
+@param checked_mode  lock mode to look for, see lock_rec_has_expl()
+@param cell          lock hash table cell
+@param id            page identifier
+@param heap_no       heap number of the record
+@param trx           transaction
+@param c_lock        conflicting lock, or nullptr; only set if the
+                     function returns nullptr
+@return the held lock
+@retval nullptr if trx does not hold a sufficient lock */
+static lock_t *lock_rec_has_expl_or_conflicting(unsigned mode,
+                                                unsigned checked_mode,
+                                                const hash_cell_t &cell,
+                                                const page_id_t id,
+                                                ulint heap_no,
+                                                const trx_t *trx,
+                                                lock_t **c_lock)
+{
+  ut_ad((checked_mode & LOCK_MODE_MASK) == LOCK_S ||
+        (checked_mode & LOCK_MODE_MASK) == LOCK_X);
+  ut_ad(!(checked_mode & LOCK_INSERT_INTENTION));
+  const lock_mode m= lock_mode(mode & LOCK_MODE_MASK);
+  lock_t *incompatible= nullptr;
+
+  for (lock_t *lock= lock_sys_t::get_first(cell, id, heap_no); lock;
+       lock= lock_rec_get_next(heap_no, lock))
+  {
+    if (lock_rec_is_expl(lock, checked_mode, heap_no, trx))
+      return lock;
+    /* Only remember where to start looking for a conflict.
+    lock_rec_has_to_wait() may have side effects (such as the
+    WSREP brute force checks), and it must not be invoked
+    unless we know that trx does not hold a sufficient lock. */
+    if (!incompatible && lock->trx != trx &&
+        !lock_mode_compatible(m, lock->mode()))
+      incompatible= lock;
+  }
+
+  /* Any lock before incompatible would not have to be waited for. */
+  const bool is_supremum= heap_no == PAGE_HEAP_NO_SUPREMUM;
+  for (lock_t *lock= incompatible; lock;
+       lock= lock_rec_get_next(heap_no, lock))
+  {
+    if (lock_rec_has_to_wait(trx, mode, lock, is_supremum))
+    {
+      *c_lock= lock;
+      return nullptr;
+    }
+  }
+
+  *c_lock= nullptr;
+  return nullptr;
+}
+
 /*********************************************************************//**
 Checks if some transaction has an implicit x-lock on a record in a secondary
 index.
@@ -1589,14 +1663,15 @@ lock_rec_lock(
                              ? mode | LOCK_REC_NOT_GAP
                              : mode;
 
+      lock_t *c_lock;
       const lock_t *held_lock=
-          lock_rec_has_expl(checked_mode, g.cell(), id, heap_no, trx);
+        lock_rec_has_expl_or_conflicting(mode, checked_mode, g.cell(), id,
+                                         heap_no, trx, &c_lock);
 
       /* Do nothing if the trx already has a strong enough lock on rec */
       if (!held_lock)
       {
-        if (lock_t *c_lock= lock_rec_other_has_conflicting(mode, g.cell(), id,
-                                                           heap_no, trx))
+        if (c_lock)
           /*
             If another transaction has a non-gap conflicting
             request in the queue, as this transaction does not
@@ -132,7 +132,7 @@ void log_t::create()
   next_checkpoint_lsn= 0;
   checkpoint_pending= false;
 
-  buf_free= 0;
+  set_buf_free(0);
 
   ut_ad(is_initialised());
 }
@@ -293,12 +293,12 @@ void log_t::create(lsn_t lsn) noexcept
   {
     mprotect(buf, size_t(file_size), PROT_READ | PROT_WRITE);
     memset_aligned<4096>(buf, 0, 4096);
-    buf_free= START_OFFSET;
+    set_buf_free(START_OFFSET);
   }
   else
 #endif
   {
-    buf_free= 0;
+    set_buf_free(0);
     memset_aligned<4096>(flush_buf, 0, buf_size);
     memset_aligned<4096>(buf, 0, buf_size);
   }
@@ -510,7 +510,7 @@ log_t::resize_start_status log_t::resize_start(os_offset_t size) noexcept
         }
         else
         {
-          memcpy_aligned<16>(resize_buf, buf, (buf_free + 15) & ~15);
+          memcpy_aligned<16>(resize_buf, buf, (get_buf_free() + 15) & ~15);
           start_lsn= first_lsn +
             (~lsn_t{get_block_size() - 1} & (write_lsn - first_lsn));
         }
@@ -825,10 +825,10 @@ template<bool release_latch> inline lsn_t log_t::write_buf() noexcept
     DBUG_PRINT("ib_log", ("write " LSN_PF " to " LSN_PF " at " LSN_PF,
                           write_lsn, lsn, offset));
     const byte *write_buf{buf};
-    size_t length{buf_free};
+    size_t length{get_buf_free()};
     ut_ad(length >= (calc_lsn_offset(write_lsn) & block_size_1));
     const size_t new_buf_free{length & block_size_1};
-    buf_free= new_buf_free;
+    set_buf_free(new_buf_free);
     ut_ad(new_buf_free == ((lsn - first_lsn) & block_size_1));
 
     if (new_buf_free)
@@ -908,6 +908,54 @@ static lsn_t log_flush(lsn_t lsn)
 
 static const completion_callback dummy_callback{[](void *) {},nullptr};
 
+/** Targets of log_write_task: the LSN up to which the log must be
+written, and the LSN up to which it must be durable */
+static std::atomic<lsn_t> log_write_task_lsn, log_flush_task_lsn;
+/** Whether log_write_task has been submitted and has not yet
+read the targets */
+static std::atomic<bool> log_write_task_pending;
+
+/** Write the log on behalf of the callers of log_write_up_to()
+that passed a completion callback. */
+static void log_write_task_callback(void *)
+{
+  log_write_task_pending.store(false);
+  for (;;)
+  {
+    const lsn_t flush_lsn= log_flush_task_lsn.load();
+    if (flush_lsn > flush_lock.value())
+      log_write_up_to(flush_lsn, true);
+    else
+    {
+      const lsn_t write_lsn= log_write_task_lsn.load();
+      if (write_lsn > write_lock.value())
+        log_write_up_to(write_lsn, false);
+      else
+        break;
+    }
+  }
+}
+
+static tpool::task_group log_write_task_group(1);
+static tpool::waitable_task log_write_task(log_write_task_callback, nullptr,
+                                           &log_write_task_group);
+
+/** Register a completion callback and let log_write_task do the write.
+@param lsn      log sequence number that should be included in the file write
+@param durable  whether the write needs to be durable
+@param callback log write completion callback */
+static void log_write_up_to_async(lsn_t lsn, bool durable,
+                                  const completion_callback &callback)
+{
+  if (!(durable ? flush_lock : write_lock).enqueue(lsn, callback))
+    return;
+  std::atomic<lsn_t> &target= durable ? log_flush_task_lsn : log_write_task_lsn;
+  for (lsn_t t= target.load(std::memory_order_relaxed);
+       t < lsn && !target.compare_exchange_weak(t, lsn); ) {}
+  if (!log_write_task_pending.exchange(true))
+    srv_thread_pool->submit_task(&log_write_task);
+}
+
 /** Ensure that the log has been written to the log file up to a given
 log entry (such as that of a transaction commit). Start a new write, or
 wait and check if an already running write is covering the request.
@@ -931,6 +979,12 @@ void log_write_up_to(lsn_t lsn, bool durable,
   }
 #endif
 
+  if (callback && srv_log_write_async && srv_thread_pool)
+  {
+    log_write_up_to_async(lsn, durable, *callback);
+    return;
+  }
+
 repeat:
   if (durable)
   {
@@ -1005,7 +1059,7 @@ Tries to establish a big enough margin of free space in the log buffer, such
 that a new log entry can be catenated without an immediate need for a flush. */
 ATTRIBUTE_COLD static void log_flush_margin()
 {
-  if (log_sys.buf_free > log_sys.max_buf_free)
+  if (log_sys.get_buf_free() > log_sys.max_buf_free)
     log_buffer_flush_to_disk(false);
 }
 
@@ -1096,6 +1150,7 @@ ATTRIBUTE_COLD void logs_empty_and_mark_files_at_shutdown()
 	/* Wait for the end of the buffer resize task.*/
 	buf_resize_shutdown();
 	dict_stats_shutdown();
+	log_write_task.wait();
 
 	srv_shutdown_state = SRV_SHUTDOWN_CLEANUP;
 
@@ -3744,6 +3744,7 @@ void recv_sys_t::apply(bool last_batch)
   mysql_mutex_assert_owner(&mutex);
 
   garbage_collect();
+  bool parallel= false;
 
   if (!pages.empty())
   {
@@ -3803,6 +3804,13 @@ void recv_sys_t::apply(bool last_batch)
 
     fil_system.extend_to_recv_size();
 
+    /* The log is applied to the pages in read completion callbacks
+    (see buf_read_recover()). Let them use all processor cores, not
+    only innodb_read_io_threads. */
+    parallel= true;
+    os_aio_set_read_concurrency(std::max(uint(my_getncpus()),
+                                         srv_n_read_io_threads));
+
     fil_space_t *space= nullptr;
     uint32_t space_id= ~0;
     buf_block_t *free_block= nullptr;
@@ -3843,6 +3851,7 @@ void recv_sys_t::apply(bool last_batch)
             mysql_mutex_unlock(&buf_pool.mutex);
             mysql_mutex_lock(&mutex);
           }
+          os_aio_set_read_concurrency(srv_n_read_io_threads);
           return;
         }
         if (apply_batch(space_id, space, free_block, last_batch))
@@ -3866,6 +3875,13 @@ void recv_sys_t::apply(bool last_batch)
 
   mysql_mutex_unlock(&mutex);
 
+  if (parallel)
+  {
+    /* Wait for the last callbacks before reducing the concurrency. */
+    os_aio_wait_until_no_pending_reads(false);
+    os_aio_set_read_concurrency(srv_n_read_io_threads);
+  }
+
   if (!last_batch)
   {
     buf_flush_sync_batch(lsn);
@@ -4587,7 +4603,7 @@ dberr_t recv_recovery_from_checkpoint_start()
 				 PROT_READ | PROT_WRITE);
 #endif
 		}
-		log_sys.buf_free = recv_sys.offset;
+		log_sys.set_buf_free(recv_sys.offset);
 		if (recv_needed_recovery
 	            && srv_operation <= SRV_OPERATION_EXPORT_RESTORED) {
 			/* Write a FILE_CHECKPOINT marker as the first thing,
@@ -278,6 +278,29 @@ group_commit_lock::lock_return_code group_commit_lock::acquire(value_type num, c
   return lock_return_code::EXPIRED;
 }
 
+/**
+Register a completion callback without acquiring the lock.
+The callback will be executed by release() once the value reaches num.
+The caller must ensure that some thread will acquire the lock and
+advance the value to at least num.
+
+@return false if the value already was at least num, and
+the callback was executed in the current thread
+*/
+bool group_commit_lock::enqueue(value_type num, const completion_callback &cb)
+{
+  {
+    std::unique_lock<std::mutex> lk(m_mtx);
+    if (num > value())
+    {
+      m_pending_callbacks.push_back({num, cb});
+      return true;
+    }
+  }
+  cb.m_callback(cb.m_param);
+  return false;
+}
+
 group_commit_lock::value_type group_commit_lock::release(value_type num)
 {
   completion_callback callbacks[1000];
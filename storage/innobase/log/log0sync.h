@@ -89,6 +89,7 @@ class group_commit_lock
     CALLBACK_QUEUED
   };
   lock_return_code acquire(value_type num, const completion_callback *cb);
+  bool enqueue(value_type num, const completion_callback &cb);
   value_type release(value_type num);
   value_type value() const;
   value_type pending() const;
@@ -870,11 +870,13 @@ ATTRIBUTE_COLD static void log_overwrite_warning(lsn_t lsn)
 }
 
 /** Wait in append_prepare() for buffer to become available
-@param ex   whether log_sys.latch is exclusively locked */
-ATTRIBUTE_COLD void log_t::append_prepare_wait(bool ex) noexcept
+@param ex   whether log_sys.latch is exclusively locked
+@param pmem whether lsn_lock is being held (log_sys.is_pmem()) */
+ATTRIBUTE_COLD void log_t::append_prepare_wait(bool ex, bool pmem) noexcept
 {
   log_sys.waits++;
-  log_sys.unlock_lsn();
+  if (pmem)
+    log_sys.unlock_lsn();
 
   if (ex)
     log_sys.latch.wr_unlock();
@@ -889,7 +891,8 @@ ATTRIBUTE_COLD void log_t::append_prepare_wait(bool ex) noexcept
   else
     log_sys.latch.rd_lock(SRW_LOCK_CALL);
 
-  log_sys.lock_lsn();
+  if (pmem)
+    log_sys.lock_lsn();
 }
 
 /** Reserve space in the log buffer for appending data.
@@ -910,28 +913,55 @@ std::pair<lsn_t,byte*> log_t::append_prepare(size_t size, bool ex) noexcept
   ut_ad(pmem == is_pmem());
   const lsn_t checkpoint_margin{last_checkpoint_lsn + log_capacity - size};
   const size_t avail{(pmem ? size_t(capacity()) : buf_size) - size};
-  lock_lsn();
   write_to_buf++;
 
-  for (ut_d(int count= 50);
-       UNIV_UNLIKELY((pmem
-                      ? size_t(get_lsn() -
-                               get_flushed_lsn(std::memory_order_relaxed))
-                      : size_t{buf_free}) > avail); )
+  lsn_t l;
+  size_t b;
+
+  if (!pmem)
   {
-    append_prepare_wait(ex);
-    ut_ad(count--);
+    /* buf_lsn can only change under exclusive latch. Reserve the
+    LSN range with a single atomic operation, so that concurrent
+    mini-transactions can copy their log to buf without further
+    synchronization. */
+    l= lsn.load(std::memory_order_relaxed);
+    for (ut_d(int count= 50);; )
+    {
+      if (UNIV_UNLIKELY(size_t(l - buf_lsn) > avail))
+      {
+        append_prepare_wait(ex, false);
+        ut_ad(count--);
+        l= lsn.load(std::memory_order_relaxed);
+      }
+      else if (lsn.compare_exchange_weak(l, l + size,
+                                         std::memory_order_relaxed,
+                                         std::memory_order_relaxed))
+        break;
+    }
+    b= size_t(l - buf_lsn);
   }
+  else
+  {
+    lock_lsn();
+    for (ut_d(int count= 50);
+         UNIV_UNLIKELY(size_t(get_lsn() -
+                              get_flushed_lsn(std::memory_order_relaxed)) >
+                       avail); )
+    {
+      append_prepare_wait(ex, true);
+      ut_ad(count--);
+    }
 
-  const lsn_t l{lsn.load(std::memory_order_relaxed)};
-  lsn.store(l + size, std::memory_order_relaxed);
-  const size_t b{buf_free};
-  size_t new_buf_free{b};
-  new_buf_free+= size;
-  if (pmem && new_buf_free >= file_size)
-    new_buf_free-= size_t(capacity());
-  buf_free= new_buf_free;
-  unlock_lsn();
+    l= lsn.load(std::memory_order_relaxed);
+    lsn.store(l + size, std::memory_order_relaxed);
+    b= buf_free;
+    size_t new_buf_free{b};
+    new_buf_free+= size;
+    if (new_buf_free >= file_size)
+      new_buf_free-= size_t(capacity());
+    buf_free= new_buf_free;
+    unlock_lsn();
+  }
 
   if (UNIV_UNLIKELY(l > checkpoint_margin) ||
       (!pmem && b >= max_buf_free))
@@ -66,8 +66,11 @@ Created 10/21/1995 Heikki Tuuri
 
 #ifdef _WIN32
 # include <winioctl.h>
-#elif !defined O_DSYNC
-# define O_DSYNC O_SYNC
+#else
+# include <sys/uio.h> /* preadv() */
+# ifndef O_DSYNC
+#  define O_DSYNC O_SYNC
+# endif
 #endif
 
 // my_test_if_atomic_write() , my_win_secattr()
@@ -170,6 +173,7 @@ static ulint	os_innodb_umask	= 0;
 Atomic_counter<ulint> os_n_file_reads;
 static ulint	os_bytes_read_since_printout;
 Atomic_counter<size_t> os_n_file_writes;
+Atomic_counter<size_t> os_n_atomic_writes;
 Atomic_counter<size_t> os_n_fsyncs;
 static ulint	os_n_file_reads_old;
 static ulint	os_n_file_writes_old;
@@ -1316,6 +1320,12 @@ os_file_create_func(
 		file = -1;
 	}
 
+	if (*success && type != OS_LOG_FILE && srv_thread_pool) {
+		/* Allow the use of io_uring fixed files for all data files,
+		also those that were opened without O_DIRECT */
+		srv_thread_pool->bind(file);
+	}
+
 	return(file);
 }
 
@@ -1500,6 +1510,8 @@ os_file_get_last_error.
 @return true if success */
 bool os_file_close_func(os_file_t file)
 {
+  if (srv_thread_pool)
+    srv_thread_pool->unbind(file);
   int ret= close(file);
 
   if (!ret)
@@ -3420,7 +3432,7 @@ static void read_io_callback(void *c)
 static void write_io_callback(void *c)
 {
   tpool::aiocb *cb= static_cast<tpool::aiocb*>(c);
-  ut_ad(cb->m_opcode == tpool::aio_opcode::AIO_PWRITE);
+  ut_ad(cb->m_opcode != tpool::aio_opcode::AIO_PREAD);
   ut_ad(write_slots->contains(cb));
   const IORequest &request= *static_cast<const IORequest*>
     (static_cast<const void*>(cb->m_userdata));
@@ -3659,10 +3671,36 @@ int os_aio_resize(ulint n_reader_threads, ulint n_writer_threads)
     /* Allocation succeeded, resize the slots*/
     read_slots->resize(max_read_events, static_cast<int>(n_reader_threads));
     write_slots->resize(max_write_events, static_cast<int>(n_writer_threads));
+    if (buf_pool.is_initialised())
+    {
+      mysql_mutex_lock(&buf_pool.mutex);
+      buf_pool.register_aio_buffers(true);
+      mysql_mutex_unlock(&buf_pool.mutex);
+    }
   }
 
   mysql_mutex_unlock(&lk_read);
   mysql_mutex_unlock(&lk_write);
+
+#ifndef _WIN32
+  if (!ret)
+  {
+    /* The new io_uring instance has an empty registered file table.
+    Rebind the data files that are currently open. Until then, any
+    requests will be submitted with plain file descriptors. */
+    mysql_mutex_lock(&fil_system.mutex);
+    for (fil_space_t &space : fil_system.space_list)
+      for (fil_node_t *node= UT_LIST_GET_FIRST(space.chain); node;
+           node= UT_LIST_GET_NEXT(chain, node))
+        if (node->is_open())
+        {
+          os_file_t file= node->handle;
+          srv_thread_pool->bind(file);
+        }
+    mysql_mutex_unlock(&fil_system.mutex);
+  }
+#endif
+
   return ret;
 }
 
@@ -3736,6 +3774,11 @@ void os_aio_wait_until_no_pending_reads(bool declare)
     tpool::tpool_wait_end();
 }
 
+void os_aio_set_read_concurrency(uint n)
+{
+  read_slots->task_group().set_max_tasks(n);
+}
+
 /** Submit a fake read request during crash recovery.
 @param type  fake read request
 @param offset additional context */
@@ -3757,6 +3800,97 @@ void os_fake_read(const IORequest &type, os_offset_t offset)
   srv_thread_pool->submit_task(&cb->m_internal_task);
 }
 
+#ifndef _WIN32
+/** Execute a read request that was submitted by os_aio_read_pages(). */
+static void read_pages_callback(void *c)
+{
+  tpool::aiocb *cb= static_cast<tpool::aiocb*>(c);
+  ut_ad(read_slots->contains(cb));
+  const IORequest &request= *static_cast<const IORequest*>
+    (static_cast<const void*>(cb->m_userdata));
+  buf_page_t **bpages= static_cast<buf_page_t**>(cb->m_buffer);
+  const size_t n= cb->m_len;
+  ut_ad(n > 1);
+  ut_ad(n <= buf_pool_t::READ_AHEAD_PAGES);
+
+  iovec iov[buf_pool_t::READ_AHEAD_PAGES];
+  for (size_t i= 0; i < n; i++)
+  {
+    iov[i].iov_base= bpages[i]->frame;
+    iov[i].iov_len= srv_page_size;
+  }
+
+#ifdef UNIV_PFS_IO
+  PSI_file_locker_state state;
+  PSI_file_locker *locker= nullptr;
+  register_pfs_file_io_begin(&state, locker, request.node->handle,
+                             n << srv_page_size_shift, PSI_FILE_READ,
+                             __FILE__, __LINE__);
+#endif /* UNIV_PFS_IO */
+
+  /* Read as many pages as possible. On a short read, continue from the
+  first page that was not completely read. */
+  size_t done= 0, partial= 0;
+  int err= 0;
+  while (done < n)
+  {
+    ssize_t len= preadv(cb->m_fh, iov + done, int(n - done),
+                        cb->m_offset + (done << srv_page_size_shift) +
+                        partial);
+    if (len <= 0)
+    {
+      if (len < 0 && errno == EINTR)
+        continue;
+      err= len ? errno : EIO;
+      break;
+    }
+    len+= partial;
+    done+= size_t(len) >> srv_page_size_shift;
+    partial= size_t(len) & (srv_page_size - 1);
+    if (partial)
+    {
+      iov[done].iov_base= bpages[done]->frame + partial;
+      iov[done].iov_len= srv_page_size - partial;
+    }
+  }
+
+#ifdef UNIV_PFS_IO
+  register_pfs_file_io_end(locker, done << srv_page_size_shift);
+#endif /* UNIV_PFS_IO */
+
+  for (size_t i= 0; i < n; i++)
+    IORequest{bpages[i], nullptr, request.node, IORequest::READ_ASYNC}.
+      read_complete(i < done ? 0 : err);
+
+  ut_free(bpages);
+  read_slots->release(cb);
+}
+
+void os_aio_read_pages(const IORequest &type, buf_page_t **bpages, size_t n,
+                       os_offset_t offset)
+{
+  ut_ad(type.type == IORequest::READ_ASYNC);
+  ut_ad(type.bpage == *bpages);
+  ut_ad(type.node->is_open());
+  ut_ad(!(offset & (srv_page_size - 1)));
+
+  ++os_n_file_reads;
+  tpool::aiocb *cb= read_slots->acquire();
+
+  cb->m_group= read_slots->get_task_group();
+  cb->m_fh= type.node->handle.m_file;
+  cb->m_buffer= bpages;
+  cb->m_len= static_cast<unsigned>(n);
+  cb->m_offset= offset;
+  cb->m_opcode= tpool::aio_opcode::AIO_PREAD;
+  new (cb->m_userdata) IORequest{type};
+  cb->m_internal_task.m_func= read_pages_callback;
+  cb->m_internal_task.m_arg= cb;
+  cb->m_internal_task.m_group= cb->m_group;
+
+  srv_thread_pool->submit_task(&cb->m_internal_task);
+}
+#endif
 
 /** Request a read or write.
 @param type		I/O request
@@ -3817,6 +3951,18 @@ dberr_t os_aio(const IORequest &type, void *buf, os_offset_t offset, size_t n)
 		slots = write_slots;
 		callback = write_io_callback;
 		opcode = tpool::aio_opcode::AIO_PWRITE;
+#ifdef HAVE_RWF_ATOMIC
+		/* Only page writes are protected by RWF_ATOMIC;
+		see fil_node_t::find_metadata(). */
+		if (type.bpage && type.node->rwf_atomic) {
+			++os_n_atomic_writes;
+			/* With simulated detection, the file may not
+			support the flag. */
+			if (!DBUG_IF("ib_simulate_rwf_atomic")) {
+				opcode = tpool::aio_opcode::AIO_PWRITE_ATOMIC;
+			}
+		}
+#endif
 	}
 
 	compile_time_assert(sizeof(IORequest) <= tpool::MAX_AIO_USERDATA_LEN);
@@ -4120,11 +4266,23 @@ void fil_node_t::find_metadata(os_file_t file
     atomic_write= true;
   }
   else
+  {
     /* On Windows, all single sector writes are atomic, as per
     WriteFile() documentation on MSDN. */
     atomic_write= srv_use_atomic_writes &&
       IF_WIN(srv_page_size == block_size,
 	     my_test_if_atomic_write(file, space->physical_size()));
+    rwf_atomic= false;
+#ifdef HAVE_RWF_ATOMIC
+    /* A page_compressed write may be shorter than the atomic write unit,
+    and a doublewrite batch to the system tablespace longer than it. */
+    if (!atomic_write && srv_use_atomic_writes &&
+        !space->is_compressed() && space->id &&
+        (my_test_if_rwf_atomic(file, space->physical_size()) ||
+         DBUG_IF("ib_simulate_rwf_atomic")))
+      atomic_write= rwf_atomic= true;
+#endif
+  }
 }
 
 /** Read the first page of a data file.
@@ -164,6 +164,13 @@ For details see: row_vers_old_has_index_entry() and row_purge_poss_sec()
 */
 
 
+#ifdef UNIV_DEBUG
+/** Number of MVCC snapshots that were not copied from
+trx_sys_t::snapshot_from_cache() */
+Atomic_counter<size_t> read_view_snapshots;
+#endif /* UNIV_DEBUG */
+
+
 /**
   Creates a snapshot where exactly the transactions serialized before this
   point in time are seen in the view.
@@ -172,23 +179,30 @@ For details see: row_vers_old_has_index_entry() and row_purge_poss_sec()
 */
 inline void ReadViewBase::snapshot(trx_t *trx)
 {
+  const uint64_t erased= trx_sys.get_rw_trx_hash_erased();
+  if (trx_sys.snapshot_from_cache(this, erased))
+    return;
+
+  ut_d(read_view_snapshots++);
   trx_sys.snapshot_ids(trx, &m_ids, &m_low_limit_id, &m_low_limit_no);
+  const trx_id_t max_trx_id= m_low_limit_id;
   if (m_ids.empty())
-  {
     m_up_limit_id= m_low_limit_id;
-    return;
-  }
-
-  std::sort(m_ids.begin(), m_ids.end());
-  m_up_limit_id= m_ids.front();
-  ut_ad(m_up_limit_id <= m_low_limit_id);
-
-  if (m_low_limit_no == m_low_limit_id &&
-      m_low_limit_id == m_up_limit_id + m_ids.size())
+  else
   {
-    m_ids.clear();
-    m_low_limit_id= m_low_limit_no= m_up_limit_id;
+    std::sort(m_ids.begin(), m_ids.end());
+    m_up_limit_id= m_ids.front();
+    ut_ad(m_up_limit_id <= m_low_limit_id);
+
+    if (m_low_limit_no == m_low_limit_id &&
+        m_low_limit_id == m_up_limit_id + m_ids.size())
+    {
+      m_ids.clear();
+      m_low_limit_id= m_low_limit_no= m_up_limit_id;
+    }
   }
+
+  trx_sys.snapshot_to_cache(*this, erased, max_trx_id);
 }
 
 
@@ -3336,6 +3336,16 @@ row_merge_blocks_copy(
 		    != NULL);
 }
 
+/** Check if a merge sort should be stopped.
+@param trx	transaction
+@param abort	flag for aborting a background sort, or NULL
+@return whether the statement was interrupted or the sort aborted */
+static bool row_merge_is_interrupted(trx_t *trx,
+				     const Atomic_relaxed<bool> *abort)
+{
+	return (abort && *abort) || trx_is_interrupted(trx);
+}
+
 /** Merge disk files.
 @param[in]	trx		transaction
 @param[in]	dup		descriptor of index being created
@@ -3350,6 +3360,7 @@ for each merge run
 @param[in]	space		tablespace ID for encryption
 ALTER TABLE. If not NULL stage->inc() will be called for each record
 processed.
+@param[in]	abort		flag for aborting a background sort, or NULL
 @return DB_SUCCESS or error code */
 static
 dberr_t
@@ -3363,7 +3374,8 @@ row_merge(
 	ulint*			run_offset,
 	ut_stage_alter_t*	stage,
 	row_merge_block_t*	crypt_block,
-	ulint			space)
+	ulint			space,
+	const Atomic_relaxed<bool>* abort)
 {
 	ulint		foffs0;	/*!< first input offset */
 	ulint		foffs1;	/*!< second input offset */
@@ -3402,7 +3414,7 @@ row_merge(
 
 	for (; foffs0 < ihalf && foffs1 < file->offset; foffs0++, foffs1++) {
 
-		if (trx_is_interrupted(trx)) {
+		if (row_merge_is_interrupted(trx, abort)) {
 			return(DB_INTERRUPTED);
 		}
 
@@ -3423,7 +3435,7 @@ row_merge(
 
 	while (foffs0 < ihalf) {
 
-		if (UNIV_UNLIKELY(trx_is_interrupted(trx))) {
+		if (UNIV_UNLIKELY(row_merge_is_interrupted(trx, abort))) {
 			return(DB_INTERRUPTED);
 		}
 
@@ -3441,7 +3453,7 @@ row_merge(
 
 	while (foffs1 < file->offset) {
 
-		if (trx_is_interrupted(trx)) {
+		if (row_merge_is_interrupted(trx, abort)) {
 			return(DB_INTERRUPTED);
 		}
 
@@ -3493,6 +3505,7 @@ row_merge(
 @param[in,out]	stage	performance schema accounting object, used by
 ALTER TABLE. If not NULL, stage->begin_phase_sort() will be called initially
 and then stage->inc() will be called for each record processed.
+@param[in]	abort	flag for aborting a background sort, or NULL
 @return DB_SUCCESS or error code */
 dberr_t
 row_merge_sort(
@@ -3510,7 +3523,8 @@ row_merge_sort(
 	const double		pct_cost, /*!< in: current progress percent */
 	row_merge_block_t*	crypt_block, /*!< in: crypt buf or NULL */
 	ulint			space,	   /*!< in: space id */
-	ut_stage_alter_t* 	stage)
+	ut_stage_alter_t* 	stage,
+	const Atomic_relaxed<bool>* abort)
 {
 	const ulint	half	= file->offset / 2;
 	ulint		num_runs;
@@ -3553,7 +3567,7 @@ row_merge_sort(
 	*/
 #ifndef __sun__
 	/* Progress report only for "normal" indexes. */
-	if (dup && !(dup->index->type & DICT_FTS)) {
+	if (update_progress && dup && !(dup->index->type & DICT_FTS)) {
 		thd_progress_init(trx->mysql_thd, 1);
 	}
 #endif /* __sun__ */
@@ -3570,14 +3584,14 @@ row_merge_sort(
 		show processlist progress field */
 		/* Progress report only for "normal" indexes. */
 #ifndef __sun__
-		if (dup && !(dup->index->type & DICT_FTS)) {
+		if (update_progress && dup && !(dup->index->type & DICT_FTS)) {
 			thd_progress_report(trx->mysql_thd, file->offset - num_runs, file->offset);
 		}
 #endif /* __sun__ */
 
 		error = row_merge(trx, dup, file, block, tmpfd,
 				  &num_runs, run_offset, stage,
-				  crypt_block, space);
+				  crypt_block, space, abort);
 
 		if(update_progress) {
 			merge_count++;
@@ -3600,7 +3614,7 @@ row_merge_sort(
 
 	/* Progress report only for "normal" indexes. */
 #ifndef __sun__
-	if (dup && !(dup->index->type & DICT_FTS)) {
+	if (update_progress && dup && !(dup->index->type & DICT_FTS)) {
 		thd_progress_end(trx->mysql_thd);
 	}
 #endif /* __sun__ */
@@ -4606,6 +4620,82 @@ row_merge_is_index_usable(
 		   || trx->read_view.changes_visible(index->trx_id)));
 }
 
+/** Merge sort of a secondary index in a background task */
+struct row_merge_bg_sort_t
+{
+	/** transaction, for checking interrupts */
+	trx_t*			trx;
+	/** descriptor of the index being created */
+	row_merge_dup_t		dup;
+	/** file containing index entries */
+	merge_file_t*		file;
+	/** number of runs in the file before sorting, for reporting
+	the progress after the sort */
+	ulint			n_runs;
+	/** location for creating the temporary file */
+	const char*		path;
+	/** tablespace identifier, for encryption */
+	ulint			space;
+	/** set when the result of the sort is no longer needed */
+	const Atomic_relaxed<bool>* abort;
+	/** result of row_merge_sort() */
+	dberr_t			error;
+	/** the task, or NULL if the index is sorted in the calling thread */
+	tpool::waitable_task*	task;
+};
+
+/** Merge-sort a file of secondary index entries in a background task.
+@param arg	row_merge_bg_sort_t */
+static void row_merge_sort_bg(void* arg)
+{
+	row_merge_bg_sort_t*	s = static_cast<row_merge_bg_sort_t*>(arg);
+
+	if (*s->abort) {
+		/* Do not allocate anything for a task that was queued
+		before the index build failed. */
+		s->error = DB_INTERRUPTED;
+		return;
+	}
+
+	DBUG_EXECUTE_IF("row_merge_sort_bg_fail",
+			s->error = DB_OUT_OF_MEMORY; return;);
+
+	ut_allocator<row_merge_block_t>	alloc(mem_key_row_merge_sort);
+	ut_new_pfx_t		block_pfx;
+	ut_new_pfx_t		crypt_pfx;
+	const size_t		block_size = 3 * srv_sort_buf_size;
+	row_merge_block_t*	block = alloc.allocate_large(block_size,
+							     &block_pfx);
+	row_merge_block_t*	crypt_block = NULL;
+	pfs_os_file_t		tmpfd = OS_FILE_CLOSED;
+
+	if (block && srv_encrypt_log) {
+		crypt_block = alloc.allocate_large(block_size, &crypt_pfx);
+	}
+
+	if (!block || (srv_encrypt_log && !crypt_block)) {
+		s->error = DB_OUT_OF_MEMORY;
+	} else if (!row_merge_tmpfile_if_needed(&tmpfd, s->path)) {
+		s->error = DB_OUT_OF_MEMORY;
+	} else {
+		/* Do not update the progress of the statement;
+		the calling thread will do that after the sort. */
+		s->error = row_merge_sort(s->trx, &s->dup, s->file, block,
+					  &tmpfd, false, 0, 0, crypt_block,
+					  s->space, NULL, s->abort);
+	}
+
+	row_merge_file_destroy_low(tmpfd);
+
+	if (crypt_block) {
+		alloc.deallocate_large(crypt_block, &crypt_pfx);
+	}
+
+	if (block) {
+		alloc.deallocate_large(block, &block_pfx);
+	}
+}
+
 /** Build indexes on a table by reading a clustered index, creating a temporary
 file containing index entries, merge sorting these index entries and inserting
 sorted index entries to indexes.
@@ -4671,6 +4761,10 @@ row_merge_build_indexes(
 	fts_psort_t*		psort_info = NULL;
 	fts_psort_t*		merge_info = NULL;
 	bool			fts_psort_initiated = false;
+	row_merge_bg_sort_t*	bg_sort = NULL;
+	tpool::task_group*	bg_sort_group = NULL;
+	/* set when the background sorts are no longer needed */
+	Atomic_relaxed<bool>	bg_sort_abort{false};
 
 	double total_static_cost = 0;
 	double total_dynamic_cost = 0;
@@ -4829,7 +4923,59 @@ row_merge_build_indexes(
 	DEBUG_SYNC_C("row_merge_after_scan");
 
 	/* Now we have files containing index entries ready for
-	sorting and inserting. */
+	sorting and inserting. While the first index is being sorted
+	and built in this thread, merge-sort the files of any further
+	non-unique secondary indexes in the background. Unique indexes
+	are sorted in this thread, because reporting a duplicate key
+	uses the record buffers of the TABLE. */
+
+	for (ulint k = 0, i = 0; i < n_indexes; i++) {
+		if (dict_index_is_spatial(indexes[i])) {
+			continue;
+		}
+
+		if (k++ == 0
+		    || (indexes[i]->type & DICT_FTS)
+		    || dict_index_is_unique(indexes[i])
+		    || merge_files[k - 1].fd == OS_FILE_CLOSED
+		    || merge_files[k - 1].offset <= 1) {
+			continue;
+		}
+
+		if (!bg_sort) {
+			bg_sort = static_cast<row_merge_bg_sort_t*>(
+				ut_zalloc_nokey(n_merge_files
+						* sizeof *bg_sort));
+			/* Each background sort allocates its own
+			buffers. Let them occupy at most 1/16 of the
+			buffer pool size. */
+			const size_t sort_mem = (srv_encrypt_log ? 6 : 3)
+				* srv_sort_buf_size;
+			const size_t max_sorts = std::max<size_t>(
+				1, std::min<size_t>(
+					my_getncpus(),
+					srv_buf_pool_curr_size / 16
+					/ sort_mem));
+			bg_sort_group = new tpool::task_group(
+				unsigned(max_sorts));
+		}
+
+		row_merge_bg_sort_t&	s = bg_sort[k - 1];
+		s.trx = trx;
+		s.dup.index = indexes[i];
+		s.dup.table = table;
+		s.dup.col_map = col_map;
+		s.dup.n_dup = 0;
+		s.file = &merge_files[k - 1];
+		s.n_runs = merge_files[k - 1].offset;
+		s.path = thd_innodb_tmpdir(trx->mysql_thd);
+		s.space = new_table->space_id;
+		s.abort = &bg_sort_abort;
+		s.error = DB_SUCCESS;
+		s.task = new tpool::waitable_task(row_merge_sort_bg, &s,
+						  bg_sort_group);
+		srv_thread_pool->submit_task(s.task);
+	}
 
 	for (ulint k = 0, i = 0; i < n_indexes; i++) {
 		dict_index_t*	sort_idx = indexes[i];
@@ -4889,12 +5035,31 @@ row_merge_build_indexes(
 						      pct_cost);
 			}
 
-			error = row_merge_sort(
+			if (bg_sort && bg_sort[k].task) {
+				bg_sort[k].task->wait();
+				delete bg_sort[k].task;
+				bg_sort[k].task = NULL;
+				error = bg_sort[k].error;
+
+				/* The background task did not update the
+				progress; account for the records that it
+				merged in every pass. */
+				const double passes = log2(
+					double(bg_sort[k].n_runs));
+				stage->begin_phase_sort(passes);
+				if (error == DB_SUCCESS) {
+					stage->inc_sorted(
+						merge_files[k].n_rec
+						* ulint(ceil(passes)));
+				}
+			} else {
+				error = row_merge_sort(
 					trx, &dup, &merge_files[k],
 					block, &tmpfd, true,
 					pct_progress, pct_cost,
 					crypt_block, new_table->space_id,
 					stage);
+			}
 
 			pct_progress += pct_cost;
 
@@ -5005,6 +5170,21 @@ row_merge_build_indexes(
 		fts_psort_initiated = false;
 	}
 
+	if (bg_sort) {
+		/* Abort and wait for any background sort whose result
+		was not consumed due to an error. */
+		bg_sort_abort = true;
+		for (i = 0; i < n_merge_files; i++) {
+			if (bg_sort[i].task) {
+				bg_sort[i].task->wait();
+				delete bg_sort[i].task;
+			}
+		}
+
+		delete bg_sort_group;
+		ut_free(bg_sort);
+	}
+
 	row_merge_file_destroy_low(tmpfd);
 
 	for (i = 0; i < n_merge_files; i++) {
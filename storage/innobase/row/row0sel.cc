@@ -60,6 +60,8 @@ Created 12/19/1997 Heikki Tuuri
 #ifdef WITH_WSREP
 #include "mysql/service_wsrep.h" /* For wsrep_thd_skip_locking */
 #endif
+#include <memory>
+#include <vector>
 
 /* Maximum number of rows to prefetch; MySQL interface has another parameter */
 #define SEL_MAX_N_PREFETCH	16
@@ -3871,11 +3873,13 @@ row_sel_prefetch_cache_init(
 	ulint	sz;
 	byte*	ptr;
 
+	const ulint n = prebuilt->fetch_cache_size();
+
 	/* Reserve space for the magic number. */
-	sz = UT_ARR_SIZE(prebuilt->fetch_cache) * (prebuilt->mysql_row_len + 8);
+	sz = n * (prebuilt->mysql_row_len + 8);
 	ptr = static_cast<byte*>(ut_malloc_nokey(sz));
 
-	for (i = 0; i < UT_ARR_SIZE(prebuilt->fetch_cache); i++) {
+	for (i = 0; i < n; i++) {
 
 		/* A user has reported memory corruption in these
 		buffers in Linux. Put magic numbers there to help
@@ -3902,7 +3906,7 @@ row_sel_fetch_last_buf(
 	row_prebuilt_t*	prebuilt)	/*!< in/out: prebuilt struct */
 {
 	ut_ad(!prebuilt->templ_contains_blob);
-	ut_ad(prebuilt->n_fetch_cached < MYSQL_FETCH_CACHE_SIZE);
+	ut_ad(prebuilt->n_fetch_cached < prebuilt->fetch_cache_limit());
 
 	if (prebuilt->fetch_cache[0] == NULL) {
 		/* Allocate memory for the fetch cache */
@@ -4455,7 +4459,8 @@ row_search_mvcc(
 		}
 
 		if (prebuilt->fetch_cache_first > 0
-		    && prebuilt->fetch_cache_first < MYSQL_FETCH_CACHE_SIZE) {
+		    && prebuilt->fetch_cache_first
+		    < prebuilt->fetch_cache_limit()) {
 early_not_found:
 			/* The previous returned row was popped from the fetch
 			cache, but the cache was not full at the time of the
@@ -5628,7 +5633,7 @@ row_search_mvcc(
 		not cache rows because there the cursor is a scrollable
 		cursor. */
 
-		ut_a(prebuilt->n_fetch_cached < MYSQL_FETCH_CACHE_SIZE);
+		ut_a(prebuilt->n_fetch_cached < prebuilt->fetch_cache_limit());
 
 		/* We only convert from InnoDB row format to MySQL row
 		format when ICP is disabled. */
@@ -5680,7 +5685,7 @@ row_search_mvcc(
 			row_sel_enqueue_cache_row_for_mysql(buf, prebuilt);
 		}
 
-		if (prebuilt->n_fetch_cached < MYSQL_FETCH_CACHE_SIZE) {
+		if (prebuilt->n_fetch_cached < prebuilt->fetch_cache_limit()) {
 			goto next_rec;
 		}
 	} else {
@@ -6835,6 +6840,241 @@ dberr_t row_check_index(row_prebuilt_t *prebuilt, ulint *n_rows)
   goto rec_loop;
 }
 
+/** Count the records in a key range of a clustered index
+that are visible in the read view of a transaction.
+@param index   clustered index
+@param trx     transaction
+@param first   first key of the range, or nullptr for the start of the index
+@param end     end key of the range (not included), or nullptr for the end
+@param n_rows  number of records counted
+@return error code */
+static dberr_t row_count_clust_range(dict_index_t *index, trx_t *trx,
+                                     const dtuple_t *first,
+                                     const dtuple_t *end, ulint *n_rows)
+{
+  rec_offs offsets_[REC_OFFS_NORMAL_SIZE];
+  rec_offs_init(offsets_);
+  rec_offs *offsets= offsets_;
+  mem_heap_t *heap= nullptr;
+  mem_heap_t *vers_heap= nullptr;
+  const bool comp= index->table->not_redundant();
+  const bool dirty_read= trx->isolation_level == TRX_ISO_READ_UNCOMMITTED;
+  ulint n= 0;
+
+  btr_pcur_t pcur;
+  pcur.btr_cur.page_cur.index= index;
+  mtr_t mtr;
+  mtr.start();
+
+  /* open_leaf() positions the cursor on the infimum, while the
+  search positions it on the first record that is not less than first */
+  dberr_t err= first
+    ? btr_pcur_open_with_no_init(first, PAGE_CUR_GE, BTR_SEARCH_LEAF,
+                                 &pcur, &mtr)
+    : pcur.open_leaf(true, index, BTR_SEARCH_LEAF, &mtr);
+
+  while (err == DB_SUCCESS)
+  {
+    const rec_t *rec= btr_pcur_get_rec(&pcur);
+
+    if (page_rec_is_supremum(rec))
+    {
+      if (btr_pcur_is_after_last_in_tree(&pcur))
+        break;
+      err= btr_pcur_move_to_next_page(&pcur, &mtr);
+      if (err == DB_SUCCESS && trx_is_interrupted(trx))
+        err= DB_INTERRUPTED;
+      continue;
+    }
+
+    if (page_rec_is_infimum(rec));
+    else if (offsets= rec_get_offsets(rec, index, offsets,
+                                      index->n_core_fields,
+                                      ULINT_UNDEFINED, &heap),
+             end && cmp_dtuple_rec(end, rec, index, offsets) <= 0)
+      break;
+    else if (rec_get_info_bits(rec, comp) & REC_INFO_MIN_REC_FLAG);
+    else if (dirty_read ||
+             trx->read_view.changes_visible(row_get_rec_trx_id(rec, index,
+                                                               offsets)))
+      n+= !rec_get_deleted_flag(rec, comp);
+    else
+    {
+      rec_t *old_vers;
+      if (vers_heap)
+        mem_heap_empty(vers_heap);
+      else
+        vers_heap= mem_heap_create(srv_page_size);
+      err= row_vers_build_for_consistent_read(rec, &mtr, index, &offsets,
+                                              &trx->read_view, &heap,
+                                              vers_heap, &old_vers, nullptr);
+      if (err != DB_SUCCESS)
+        break;
+      n+= old_vers && !rec_get_deleted_flag(old_vers, comp);
+    }
+
+    if (!btr_pcur_move_to_next_on_page(&pcur))
+      err= DB_CORRUPTION;
+  }
+
+  mtr.commit();
+  if (heap)
+    mem_heap_free(heap);
+  if (vers_heap)
+    mem_heap_free(vers_heap);
+  *n_rows= n;
+  return err;
+}
+
+/** @return the task group that limits the number of row_count_parallel()
+tasks that run at a time */
+static tpool::task_group &row_count_task_group()
+{
+  static tpool::task_group group(my_getncpus());
+  return group;
+}
+
+#ifdef UNIV_DEBUG
+/** Number of tasks that row_count_parallel() has submitted */
+Atomic_counter<size_t> row_count_parallel_tasks;
+#endif /* UNIV_DEBUG */
+
+/** Partitions of a clustered index that row_count_parallel() counts */
+struct row_count_parts
+{
+  dict_index_t *index;
+  trx_t *trx;
+  /** bounds[i] is the first key of partition i; nullptr stands for
+  the start and the end of the index */
+  std::vector<const dtuple_t*> bounds;
+  /** the next partition to count */
+  std::atomic<size_t> next_part{0};
+  /** number of records counted */
+  std::atomic<ulint> total{0};
+  /** the first error */
+  std::atomic<dberr_t> error{DB_SUCCESS};
+
+  /** Count partitions until all of them have been started. */
+  void count()
+  {
+    const size_t n_parts= bounds.size() - 1;
+    for (size_t i; (i= next_part.fetch_add(1)) < n_parts; )
+    {
+      ulint n;
+      dberr_t e= row_count_clust_range(index, trx, bounds[i],
+                                       bounds[i + 1], &n);
+      if (e != DB_SUCCESS)
+      {
+        dberr_t expected= DB_SUCCESS;
+        error.compare_exchange_strong(expected, e);
+        next_part.store(n_parts);
+        break;
+      }
+      total.fetch_add(n);
+    }
+  }
+
+  static void count_task(void *parts)
+  { static_cast<row_count_parts*>(parts)->count(); }
+};
+
+/** Count the records of the clustered index that are visible in the
+read view of the transaction, with several threads. The key space is
+partitioned by the node pointers in the root page. The partitions are
+counted by the calling thread and by tasks in srv_thread_pool.
+@param prebuilt   table and transaction
+@param n_threads  maximum number of threads
+@param n_rows     number of records counted
+@return error code */
+dberr_t row_count_parallel(row_prebuilt_t *prebuilt, ulint n_threads,
+                           ulint *n_rows)
+{
+  dict_index_t *const index= dict_table_get_first_index(prebuilt->table);
+  trx_t *const trx= prebuilt->trx;
+  ut_ad(index->is_primary());
+  ut_ad(trx->isolation_level == TRX_ISO_READ_UNCOMMITTED ||
+        trx->read_view.is_open());
+
+  *n_rows= 0;
+
+  if (const trx_id_t bulk_trx_id= index->table->bulk_trx_id)
+    if (!trx->read_view.changes_visible(bulk_trx_id))
+      return DB_SUCCESS;
+
+  mem_heap_t *heap= mem_heap_create(srv_page_size);
+  row_count_parts parts;
+  parts.index= index;
+  parts.trx= trx;
+  std::vector<const dtuple_t*> &bounds= parts.bounds;
+  bounds.push_back(nullptr);
+  dberr_t err;
+  mtr_t mtr;
+  mtr.start();
+
+  if (const buf_block_t *root= btr_root_block_get(index, RW_S_LATCH,
+                                                  &mtr, &err))
+  {
+    if (!page_is_leaf(root->page.frame))
+    {
+      const ulint n_fields= dict_index_get_n_unique_in_tree_nonleaf(index);
+      rec_offs *offsets= nullptr;
+      const rec_t *rec= page_get_infimum_rec(root->page.frame);
+
+      /* The first node pointer is the minimum record. */
+      if (!(rec= page_rec_get_next_const(rec)))
+        err= DB_CORRUPTION;
+      else
+        while ((rec= page_rec_get_next_const(rec)) &&
+               !page_rec_is_supremum(rec))
+        {
+          offsets= rec_get_offsets(rec, index, offsets, 0, ULINT_UNDEFINED,
+                                   &heap);
+          const rec_t *copy= rec_copy(mem_heap_alloc(heap,
+                                                     rec_offs_size(offsets)),
+                                      rec, offsets);
+          bounds.push_back(dict_index_build_data_tuple(copy, index, false,
+                                                       n_fields, heap));
+        }
+
+      if (!rec)
+        err= DB_CORRUPTION;
+    }
+  }
+
+  mtr.commit();
+  bounds.push_back(nullptr);
+
+  if (err == DB_SUCCESS)
+  {
+    n_threads= std::min<ulint>(n_threads, bounds.size() - 1);
+    std::vector<std::unique_ptr<tpool::waitable_task>> tasks;
+    tasks.reserve(n_threads - 1);
+    tpool::task_group &group= row_count_task_group();
+    for (ulint i= 1; i < n_threads; i++)
+    {
+      tasks.emplace_back(new tpool::waitable_task(row_count_parts::count_task,
+                                                  &parts, &group));
+      srv_thread_pool->submit_task(tasks.back().get());
+      ut_d(row_count_parallel_tasks++);
+    }
+
+    parts.count();
+
+    for (std::unique_ptr<tpool::waitable_task> &task : tasks)
+    {
+      /* A task that has not started would find nothing to count. */
+      group.cancel_pending(task.get());
+      task->wait();
+    }
+
+    err= parts.error;
+    *n_rows= parts.total;
+  }
+
+  mem_heap_free(heap);
+  return err;
+}
+
 /*******************************************************************//**
 Read the AUTOINC column from the current row. If the value is less than
 0 and the type is not unsigned then we reset the value to 0.
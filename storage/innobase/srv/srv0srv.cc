@@ -138,6 +138,8 @@ OS (provided we compiled Innobase with it in), otherwise we will
 use simulated aio we build below with threads.
 Currently we support native aio on windows and linux */
 my_bool	srv_use_native_aio;
+/** innodb_use_registered_buffers */
+my_bool	srv_use_registered_buffers;
 my_bool	srv_numa_interleave;
 /** copy of innodb_use_atomic_writes; @see innodb_init_params() */
 my_bool	srv_use_atomic_writes;
@@ -152,6 +154,8 @@ at startup (while disallowing writes to the redo log). */
 ulonglong	srv_log_file_size;
 /** innodb_flush_log_at_trx_commit */
 ulong		srv_flush_log_at_trx_commit;
+/** innodb_log_write_async */
+my_bool		srv_log_write_async;
 /** innodb_flush_log_at_timeout */
 uint		srv_flush_log_at_timeout;
 /** innodb_page_size */
@@ -75,6 +75,7 @@ Created 2/16/1996 Heikki Tuuri
 #include "trx0rseg.h"
 #include "buf0flu.h"
 #include "buf0rea.h"
+#include "buf0tier.h"
 #include "dict0boot.h"
 #include "dict0load.h"
 #include "dict0stats_bg.h"
@@ -1331,6 +1332,8 @@ dberr_t srv_start(bool create_new_db)
 		return(srv_init_abort(DB_ERROR));
 	}
 
+	buf_tier.create();
+
 	ib::info() << "Completed initialization of buffer pool";
 
 #ifdef UNIV_DEBUG
@@ -2046,6 +2049,9 @@ void innodb_shutdown()
 	recv_sys.close();
 
 	ut_ad(buf_pool.is_initialised() || !srv_was_started);
+	if (buf_pool.is_initialised()) {
+		buf_tier.close();
+	}
 	buf_pool.close();
 
 	srv_sys_space.shutdown();
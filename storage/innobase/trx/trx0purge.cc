@@ -25,6 +25,7 @@ Created 3/26/1996 Heikki Tuuri
 *******************************************************/
 
 #include "trx0purge.h"
+#include "buf0rea.h"
 #include "fsp0fsp.h"
 #include "mach0data.h"
 #include "mtr0log.h"
@@ -912,6 +913,22 @@ static void trx_purge_rseg_get_next_history_log(
   purge_sys.rseg->latch.wr_unlock();
 }
 
+/** Read the next page of an undo log in the background, so that
+trx_purge_get_next_rec() will not have to wait for it.
+@param block  latched undo log page */
+static void trx_purge_prefetch_next_page(const buf_block_t *block)
+{
+  const uint32_t next= mach_read_from_4(TRX_UNDO_PAGE_HDR +
+                                        TRX_UNDO_PAGE_NODE + FLST_NEXT +
+                                        FIL_ADDR_PAGE + block->page.frame);
+  if (next == FIL_NULL)
+    return;
+  fil_space_t *space= purge_sys.rseg->space;
+  ut_ad(space->id == block->page.id().space());
+  if (space->acquire())
+    buf_read_page_background(space, page_id_t(space->id, next), 0);
+}
+
 /** Position the purge sys "iterator" on the undo record to use for purging. */
 static void trx_purge_read_undo_rec()
 {
@@ -934,6 +951,7 @@ static void trx_purge_read_undo_rec()
 			offset = page_offset(undo_rec);
 			undo_no = trx_undo_rec_get_undo_no(undo_rec);
 			page_no = undo_page->page.id().page_no();
+			trx_purge_prefetch_next_page(undo_page);
 		} else {
 			offset = 0;
 			undo_no = 0;
@@ -1049,6 +1067,7 @@ trx_purge_get_next_rec(
 		if (undo_page != rec2_page) {
 			/* We advance to a new page of the undo log: */
 			(*n_pages_handled)++;
+			trx_purge_prefetch_next_page(rec2_page);
 		}
 	}
 
@@ -146,6 +146,10 @@ void trx_sys_t::create()
   m_initialised= true;
   trx_list.create();
   rw_trx_hash.init();
+  m_rw_trx_hash_erased.store(0, std::memory_order_relaxed);
+  m_snapshot_latch.init();
+  m_snapshot_max_trx_id= TRX_ID_MAX;
+  m_snapshot_erased= 0;
 }
 
 size_t trx_sys_t::history_size()
@@ -320,6 +324,11 @@ trx_sys_t::close()
 	}
 
 	rw_trx_hash.destroy();
+	/* Free the cached snapshot, and make sure that it will not be
+	used if the transaction system is created again. */
+	m_snapshot = ReadViewBase();
+	m_snapshot_max_trx_id = TRX_ID_MAX;
+	m_snapshot_latch.destroy();
 
 	/* There can't be any active transactions. */
 
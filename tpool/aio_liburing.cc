@@ -71,6 +71,20 @@ class aio_uring final : public tpool::aio
                       ME_ERROR_LOG | ME_WARNING, errno);
     }
 
+    /* Reserve a sparse table of fixed files, indexed by file descriptor,
+    so that bind() and unbind() can update single entries. Older kernels
+    only support smaller tables. Without it, plain file descriptors will
+    be submitted. */
+    for (unsigned n= MAX_FIXED_FILES; n >= 1024; n/= 4)
+    {
+      std::vector<int> fds(n, -1);
+      if (!io_uring_register_files(&uring_, fds.data(), n))
+      {
+        fixed_files_.resize(n);
+        break;
+      }
+    }
+
     thread_= std::thread(thread_routine, this);
   }
 
@@ -105,12 +119,31 @@ class aio_uring final : public tpool::aio
     std::lock_guard<std::mutex> _(mutex_);
 
     io_uring_sqe *sqe= io_uring_get_sqe(&uring_);
-    if (cb->m_opcode == tpool::aio_opcode::AIO_PREAD)
-      io_uring_prep_readv(sqe, cb->m_fh, static_cast<struct iovec *>(cb), 1,
-                          cb->m_offset);
+    const int buf_index= find_buffer(cb->m_buffer, cb->m_len);
+    if (buf_index < 0)
+    {
+      if (cb->m_opcode == tpool::aio_opcode::AIO_PREAD)
+        io_uring_prep_readv(sqe, cb->m_fh, static_cast<struct iovec *>(cb), 1,
+                            cb->m_offset);
+      else
+        io_uring_prep_writev(sqe, cb->m_fh, static_cast<struct iovec *>(cb),
+                             1, cb->m_offset);
+    }
+    else if (cb->m_opcode == tpool::aio_opcode::AIO_PREAD)
+      io_uring_prep_read_fixed(sqe, cb->m_fh, cb->m_buffer, cb->m_len,
+                               cb->m_offset, buf_index);
     else
-      io_uring_prep_writev(sqe, cb->m_fh, static_cast<struct iovec *>(cb), 1,
-                           cb->m_offset);
+      io_uring_prep_write_fixed(sqe, cb->m_fh, cb->m_buffer, cb->m_len,
+                                cb->m_offset, buf_index);
+    if (size_t(cb->m_fh) < fixed_files_.size() && fixed_files_[cb->m_fh])
+    {
+      /* The slot in the registered file table is the file descriptor */
+      sqe->flags|= IOSQE_FIXED_FILE;
+    }
+#ifdef HAVE_RWF_ATOMIC
+    if (cb->m_opcode == tpool::aio_opcode::AIO_PWRITE_ATOMIC)
+      sqe->rw_flags= RWF_ATOMIC;
+#endif
     io_uring_sqe_set_data(sqe, cb);
 
     return io_uring_submit(&uring_) == 1 ? 0 : -1;
@@ -118,25 +151,98 @@ class aio_uring final : public tpool::aio
 
   int bind(native_file_handle &fd) final
   {
-    std::lock_guard<std::mutex> _(files_mutex_);
-    auto it= std::lower_bound(files_.begin(), files_.end(), fd);
-    assert(it == files_.end() || *it != fd);
-    files_.insert(it, fd);
-    return io_uring_register_files_update(&uring_, 0, files_.data(),
-                                          files_.size());
+    if (size_t(fd) >= fixed_files_.size())
+      return 0;
+    std::lock_guard<std::mutex> _(mutex_);
+    int f= fd;
+    fixed_files_[fd]=
+      io_uring_register_files_update(&uring_, unsigned(fd), &f, 1) == 1;
+    return 0;
   }
 
   int unbind(const native_file_handle &fd) final
   {
-    std::lock_guard<std::mutex> _(files_mutex_);
-    auto it= std::lower_bound(files_.begin(), files_.end(), fd);
-    assert(*it == fd);
-    files_.erase(it);
-    return io_uring_register_files_update(&uring_, 0, files_.data(),
-                                          files_.size());
+    if (size_t(fd) >= fixed_files_.size())
+      return 0;
+    std::lock_guard<std::mutex> _(mutex_);
+    /* The file may have been bound to a previous instance of aio_uring
+    (before innodb_read_io_threads or innodb_write_io_threads changed) */
+    if (!fixed_files_[fd])
+      return 0;
+    fixed_files_[fd]= false;
+    int f= -1;
+    return io_uring_register_files_update(&uring_, unsigned(fd), &f, 1) == 1
+      ? 0 : -1;
+  }
+
+  int register_buffers(void *const *bufs, const size_t *sizes,
+                       size_t n) final
+  {
+    std::vector<iovec> buffers;
+    for (size_t i= 0; i < n; i++)
+    {
+      /* A registered buffer may be at most 1 GiB. Split at multiples of
+      1 GiB, so that no aligned block will straddle a boundary. */
+      char *b= static_cast<char*>(bufs[i]);
+      char *const end= b + sizes[i];
+      while (b < end)
+      {
+        char *e= reinterpret_cast<char*>
+          ((reinterpret_cast<uintptr_t>(b) | (MAX_FIXED_BUFFER - 1)) + 1);
+        if (e > end)
+          e= end;
+        buffers.push_back({b, size_t(e - b)});
+        b= e;
+      }
+    }
+    std::sort(buffers.begin(), buffers.end(),
+              [](const iovec &a, const iovec &b)
+              { return a.iov_base < b.iov_base; });
+
+    std::lock_guard<std::mutex> _(mutex_);
+    if (!buffers_.empty())
+    {
+      buffers_.clear();
+      io_uring_unregister_buffers(&uring_);
+    }
+    if (buffers.empty())
+      return 0;
+    if (buffers.size() > MAX_FIXED_BUFFERS)
+      return E2BIG;
+    if (int ret= io_uring_register_buffers(&uring_, buffers.data(),
+                                           unsigned(buffers.size())))
+      return -ret;
+    buffers_= std::move(buffers);
+    return 0;
   }
 
 private:
+  /** Maximum size of the registered file table */
+  static constexpr unsigned MAX_FIXED_FILES= 32768;
+  /** Maximum number of registered buffers (UIO_MAXIOV) */
+  static constexpr size_t MAX_FIXED_BUFFERS= 1024;
+  /** Maximum size of a registered buffer */
+  static constexpr uintptr_t MAX_FIXED_BUFFER= uintptr_t{1} << 30;
+
+  /** Look up a registered buffer.
+  @param buf  start of a block
+  @param len  length of the block
+  @return index of the registered buffer that contains the block
+  @retval -1 if the block is not in registered memory */
+  int find_buffer(const void *buf, size_t len) const
+  {
+    auto it= std::upper_bound(buffers_.begin(), buffers_.end(), buf,
+                              [](const void *b, const iovec &v)
+                              { return b < v.iov_base; });
+    if (it == buffers_.begin())
+      return -1;
+    --it;
+    const char *start= static_cast<const char*>(it->iov_base);
+    if (static_cast<const char*>(buf) + len > start + it->iov_len)
+      return -1;
+    return int(it - buffers_.begin());
+  }
+
   static void thread_routine(aio_uring *aio)
   {
     for (;;)
@@ -188,8 +294,11 @@ class aio_uring final : public tpool::aio
   tpool::thread_pool *tpool_;
   std::thread thread_;
 
-  std::vector<native_file_handle> files_;
-  std::mutex files_mutex_;
+  /** whether a file descriptor is registered at its index in the
+  fixed file table; protected by mutex_ */
+  std::vector<bool> fixed_files_;
+  /** registered buffers, ordered by address; protected by mutex_ */
+  std::vector<iovec> buffers_;
 };
 
 } // namespace
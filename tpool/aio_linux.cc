@@ -161,6 +161,20 @@ class aio_linux final : public aio
                   cb->m_offset);
     if (cb->m_opcode != aio_opcode::AIO_PREAD)
       cb->aio_lio_opcode= IO_CMD_PWRITE;
+    if (cb->m_opcode == aio_opcode::AIO_PWRITE_ATOMIC)
+    {
+#if defined HAVE_RWF_ATOMIC && defined HAVE_LIBAIO_RW_FLAGS
+      cb->aio_rw_flags= RWF_ATOMIC;
+#else
+      /* libaio before 0.3.111 cannot pass RWF_ATOMIC; write synchronously */
+      synchronous(cb);
+      cb->m_internal_task.m_func= cb->m_callback;
+      cb->m_internal_task.m_arg= cb;
+      cb->m_internal_task.m_group= cb->m_group;
+      m_pool->submit_task(&cb->m_internal_task);
+      return 0;
+#endif
+    }
     iocb *icb= static_cast<iocb*>(cb);
     int ret= io_submit(m_io_ctx, 1, &icb);
     if (ret == 1)
@@ -55,7 +55,7 @@ namespace tpool
   void task_group::execute(task* t)
   {
     std::unique_lock<std::mutex> lk(m_mtx);
-    if (m_tasks_running == m_max_concurrent_tasks)
+    if (m_tasks_running >= m_max_concurrent_tasks)
     {
       /* Queue for later execution by another thread.*/
       m_queue.push(t);
@@ -18,11 +18,12 @@ Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02111 - 1301 USA*/
 #include <condition_variable>
 #include <mutex>
 #include <atomic>
+#include <cerrno>
 #include <tpool_structs.h>
 #ifdef LINUX_NATIVE_AIO
 #include <libaio.h>
 #endif
-#ifdef HAVE_URING
+#if defined HAVE_URING || defined __linux__
 #include <sys/uio.h>
 #endif
 #ifdef _WIN32
@@ -117,7 +118,9 @@ class waitable_task :public task
 enum class aio_opcode
 {
   AIO_PREAD,
-  AIO_PWRITE
+  AIO_PWRITE,
+  /** write with torn-write protection by the Linux kernel (RWF_ATOMIC) */
+  AIO_PWRITE_ATOMIC
 };
 constexpr size_t MAX_AIO_USERDATA_LEN= 4 * sizeof(void*);
 
@@ -167,10 +170,21 @@ class aio
     On completion, cb->m_callback is executed.
   */
   virtual int submit_io(aiocb *cb)= 0;
-  /** "Bind" file to AIO handler (used on Windows only) */
+  /** "Bind" file to AIO handler (Windows; io_uring fixed files) */
   virtual int bind(native_file_handle &fd)= 0;
-  /** "Unind" file to AIO handler (used on Windows only) */
+  /** "Unind" file to AIO handler (Windows; io_uring fixed files) */
   virtual int unbind(const native_file_handle &fd)= 0;
+  /**
+    Register memory that is used for IO, so that it need not be
+    mapped for each request (io_uring fixed buffers).
+    Any previously registered memory is unregistered.
+    @param bufs  start addresses of the memory ranges
+    @param sizes lengths of the memory ranges, in bytes
+    @param n     number of memory ranges
+    @return 0 on success, or an errno
+  */
+  virtual int register_buffers(void *const *, const size_t *, size_t n)
+  { return n ? ENOTSUP : 0; }
   virtual ~aio(){};
 protected:
   static void synchronous(aiocb *cb);
@@ -251,8 +265,10 @@ class thread_pool
   {
     m_aio.reset();
   }
-  int bind(native_file_handle &fd) { return m_aio->bind(fd); }
+  int bind(native_file_handle &fd) { return m_aio ? m_aio->bind(fd) : 0; }
   void unbind(const native_file_handle &fd) { if (m_aio) m_aio->unbind(fd); }
+  int register_buffers(void *const *bufs, const size_t *sizes, size_t n)
+  { return m_aio ? m_aio->register_buffers(bufs, sizes, n) : ENOTSUP; }
   int submit_io(aiocb *cb) { return m_aio->submit_io(cb); }
   virtual void wait_begin() {};
   virtual void wait_end() {};
@@ -71,6 +71,14 @@ void aio::synchronous(aiocb *cb)
   case aio_opcode::AIO_PWRITE:
     ret_len= pwrite(cb->m_fh, cb->m_buffer, cb->m_len, cb->m_offset);
     break;
+#ifdef HAVE_RWF_ATOMIC
+  case aio_opcode::AIO_PWRITE_ATOMIC:
+    {
+      iovec iov{cb->m_buffer, cb->m_len};
+      ret_len= pwritev2(cb->m_fh, &iov, 1, cb->m_offset, RWF_ATOMIC);
+    }
+    break;
+#endif
   default:
     abort();
   }
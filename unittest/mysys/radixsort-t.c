@@ -0,0 +1,94 @@
+/* Copyright (c) 2024, MariaDB Corporation.
+
+   This program is free software; you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation; version 2 of the License.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program; if not, write to the Free Software
+   Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1335  USA */
+
+#include <my_global.h>
+#include <my_sys.h>
+#include <my_rnd.h>
+#include "tap.h"
+
+static struct my_rnd_struct rnd;
+
+/*
+  Fill keys with n random keys of key_length bytes. Only the lowest
+  'random_bytes' bytes of a key vary, so that there are long common
+  prefixes and many duplicates.
+*/
+static void fill_keys(uchar *keys, uchar **ptrs, uint n, size_t key_length,
+                      size_t random_bytes)
+{
+  uint i;
+  size_t j;
+  for (i= 0; i < n; i++)
+  {
+    uchar *key= keys + i * key_length;
+    for (j= 0; j < key_length; j++)
+      key[j]= j < key_length - random_bytes
+        ? 0x55 : (uchar) (my_rnd(&rnd) * 256);
+    ptrs[i]= key;
+  }
+}
+
+/*
+  Check that the keys are in ascending order, and that equal keys
+  retained their original (ascending address) order.
+*/
+static my_bool check_sorted(uchar **ptrs, uint n, size_t key_length)
+{
+  uint i;
+  for (i= 1; i < n; i++)
+  {
+    int cmp= memcmp(ptrs[i - 1], ptrs[i], key_length);
+    if (cmp > 0 || (cmp == 0 && ptrs[i - 1] > ptrs[i]))
+      return FALSE;
+  }
+  return TRUE;
+}
+
+static void test_sort(uint n, size_t key_length, size_t random_bytes)
+{
+  uchar *keys= (uchar*) my_malloc(PSI_NOT_INSTRUMENTED, n * key_length,
+                                  MYF(MY_FAE));
+  uchar **ptrs= (uchar**) my_malloc(PSI_NOT_INSTRUMENTED, n * sizeof(uchar*),
+                                    MYF(MY_FAE));
+  uchar **buffer= (uchar**) my_malloc(PSI_NOT_INSTRUMENTED,
+                                      n * sizeof(uchar*), MYF(MY_FAE));
+  fill_keys(keys, ptrs, n, key_length, random_bytes);
+  radixsort_for_str_ptr(ptrs, n, key_length, buffer);
+  ok(check_sorted(ptrs, n, key_length),
+     "radixsort of %u keys of %u bytes, %u random",
+     n, (uint) key_length, (uint) random_bytes);
+  my_free(buffer);
+  my_free(ptrs);
+  my_free(keys);
+}
+
+int main(int argc __attribute__((unused)), char *argv[])
+{
+  MY_INIT(argv[0]);
+  my_rnd_init(&rnd, 17, 42);
+  plan(8);
+
+  test_sort(1000, 4, 4);
+  test_sort(50000, 8, 2);
+  test_sort(50000, 20, 20);
+  test_sort(100000, 4, 4);
+  test_sort(300000, 8, 8);
+  test_sort(300000, 8, 1);
+  test_sort(300000, 20, 3);
+  test_sort(300000, 1, 1);
+
+  my_end(0);
+  return exit_status();
+}
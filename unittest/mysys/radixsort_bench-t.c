@@ -0,0 +1,93 @@
+/* Copyright (c) 2024, MariaDB Corporation.
+
+   This program is free software; you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation; version 2 of the License.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program; if not, write to the Free Software
+   Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1335  USA */
+
+/*
+  Compare the time of radixsort_for_str_ptr() and my_qsort2() for
+  sorting a large number of random keys. The correctness of radixsort
+  is covered by radixsort-t.
+*/
+
+#include <my_global.h>
+#include <my_sys.h>
+#include <my_rnd.h>
+#include "tap.h"
+
+static struct my_rnd_struct rnd;
+
+static void fill_keys(uchar *keys, uchar **ptrs, uint n, size_t key_length)
+{
+  uint i;
+  size_t j;
+  for (i= 0; i < n; i++)
+  {
+    uchar *key= keys + i * key_length;
+    for (j= 0; j < key_length; j++)
+      key[j]= (uchar) (my_rnd(&rnd) * 256);
+    ptrs[i]= key;
+  }
+}
+
+static my_bool check_sorted(uchar **ptrs, uint n, size_t key_length)
+{
+  uint i;
+  for (i= 1; i < n; i++)
+    if (memcmp(ptrs[i - 1], ptrs[i], key_length) > 0)
+      return FALSE;
+  return TRUE;
+}
+
+static void benchmark(uint n, size_t key_length)
+{
+  uchar *keys= (uchar*) my_malloc(PSI_NOT_INSTRUMENTED, n * key_length,
+                                  MYF(MY_FAE));
+  uchar **ptrs= (uchar**) my_malloc(PSI_NOT_INSTRUMENTED, n * sizeof(uchar*),
+                                    MYF(MY_FAE));
+  uchar **buffer= (uchar**) my_malloc(PSI_NOT_INSTRUMENTED,
+                                      n * sizeof(uchar*), MYF(MY_FAE));
+  ulonglong start, radix_time, qsort_time;
+  my_bool sorted;
+
+  fill_keys(keys, ptrs, n, key_length);
+  start= my_interval_timer();
+  radixsort_for_str_ptr(ptrs, n, key_length, buffer);
+  radix_time= my_interval_timer() - start;
+  sorted= check_sorted(ptrs, n, key_length);
+
+  fill_keys(keys, ptrs, n, key_length);
+  start= my_interval_timer();
+  my_qsort2(ptrs, n, sizeof(uchar*), get_ptr_compare(key_length),
+            &key_length);
+  qsort_time= my_interval_timer() - start;
+
+  ok(sorted, "%u keys of %u bytes: radixsort %llu us, my_qsort2 %llu us",
+     n, (uint) key_length, radix_time / 1000, qsort_time / 1000);
+  my_free(buffer);
+  my_free(ptrs);
+  my_free(keys);
+}
+
+int main(int argc __attribute__((unused)), char *argv[])
+{
+  MY_INIT(argv[0]);
+  my_rnd_init(&rnd, 17, 42);
+  plan(3);
+
+  benchmark(1000000, 4);
+  benchmark(1000000, 8);
+  benchmark(1000000, 16);
+
+  my_end(0);
+  return exit_status();
+}
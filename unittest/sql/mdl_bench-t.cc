@@ -0,0 +1,137 @@
+/*
+   Copyright (c) 2024, MariaDB Corporation.
+
+   This program is free software; you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation; version 2 of the License.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program; if not, write to the Free Software
+   Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1335 USA */
+
+/*
+  Throughput of metadata lock acquisition, in the style of sysbench:
+  every thread executes "statements" which acquire the backup lock and
+  a shared lock on a table, and release them at the end of the statement.
+  With a single table all threads contend for the same MDL_lock object.
+*/
+
+#include "mariadb.h"
+#include "mdl.h"
+#include <tap.h>
+#include <atomic>
+
+/*
+  A context owner which never waits: the statements below only request
+  lock types that are compatible with each other.
+*/
+class Bench_owner : public MDL_context_owner
+{
+public:
+  void enter_cond(mysql_cond_t *, mysql_mutex_t *, const PSI_stage_info *,
+                  PSI_stage_info *, const char *, const char *, int) override
+  {}
+  void exit_cond(const PSI_stage_info *, const char *, const char *,
+                 int) override
+  {}
+  int is_killed() override { return 0; }
+  THD *get_thd() override { return NULL; }
+  bool notify_shared_lock(MDL_context_owner *, bool) override
+  { return false; }
+};
+
+static std::atomic<uint> bad;
+static std::atomic<uint> thread_number;
+static uint n_tables;
+
+pthread_handler_t test_mdl_statements(void *arg)
+{
+  const int m= *(int *) arg;
+  Bench_owner owner;
+  my_thread_init();
+  const uint offset= thread_number++;
+
+  {
+    MDL_context mdl_context;
+    mdl_context.init(&owner);
+
+    for (int i= 0; i < m; i++)
+    {
+      char name[16];
+      MDL_request backup_request, table_request;
+      snprintf(name, sizeof name, "t%u", (offset + i) % n_tables);
+      MDL_REQUEST_INIT(&backup_request, MDL_key::BACKUP, "", "",
+                       MDL_BACKUP_DML, MDL_STATEMENT);
+      MDL_REQUEST_INIT(&table_request, MDL_key::TABLE, "sbtest", name,
+                       i & 1 ? MDL_SHARED_WRITE : MDL_SHARED_READ,
+                       MDL_STATEMENT);
+      if (mdl_context.acquire_lock(&backup_request, 1) ||
+          mdl_context.acquire_lock(&table_request, 1))
+        bad++;
+      mdl_context.release_statement_locks();
+    }
+
+    if (mdl_context.has_locks())
+      bad++;
+    mdl_context.destroy();
+  }
+
+  my_thread_end();
+  return 0;
+}
+
+static void test_concurrently(uint tables, int n, int m)
+{
+  pthread_t *threads= new pthread_t[n];
+  ulonglong now= my_interval_timer();
+
+  bad= 0;
+  n_tables= tables;
+
+  for (int i= 0; i < n; i++)
+  {
+    if (pthread_create(&threads[i], 0, test_mdl_statements, &m) != 0)
+    {
+      diag("Could not create thread");
+      abort();
+    }
+  }
+
+  for (int i= 0; i < n; i++)
+    pthread_join(threads[i], 0);
+
+  now= my_interval_timer() - now;
+  delete[] threads;
+  ok(!bad, "%d threads, %u tables: %g statements/s (%u)", n, tables,
+     double(n) * m * 1e9 / double(now ? now : 1), uint(bad));
+}
+
+int main(int argc __attribute__((unused)), char **argv)
+{
+  MY_INIT(argv[0]);
+
+  if (argv[1] && *argv[1])
+    DBUG_SET_INITIAL(argv[1]);
+
+#define CYCLES 100000
+#define THREADS 32
+
+  mdl_init();
+
+  plan(4);
+  diag("N CPUs: %d", my_getncpus());
+
+  test_concurrently(1, 1, CYCLES);
+  test_concurrently(64, 1, CYCLES);
+  test_concurrently(1, THREADS, CYCLES);
+  test_concurrently(64, THREADS, CYCLES);
+
+  mdl_destroy();
+  my_end(0);
+  return exit_status();
+}
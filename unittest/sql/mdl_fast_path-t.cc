@@ -0,0 +1,273 @@
+/*
+   Copyright (c) 2024, MariaDB Corporation.
+
+   This program is free software; you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation; version 2 of the License.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program; if not, write to the Free Software
+   Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1335 USA */
+
+/*
+  Correctness of the metadata lock fast path under concurrency.
+
+  DML threads acquire MDL_BACKUP_DML and shared table locks, which are
+  granted through the fast path shards once an object is contended.
+  Meanwhile other threads request MDL_EXCLUSIVE table locks (like DDL)
+  and MDL_BACKUP_FTWRL1 (like FLUSH TABLES WITH READ LOCK or BACKUP STAGE),
+  which must disable the fast path and see every ticket in the shards.
+  The objects are created and removed all the time, so that
+  MDL_map::remove() will run while the shards are not empty.
+
+  All requests are made without waiting; a conflicting request fails.
+  We check that conflicting locks are never held at the same time, that
+  every granted lock is visible to MDL_context::is_lock_owner(), and that
+  no tickets are left behind.
+*/
+
+#include "mariadb.h"
+#include "mdl.h"
+#include <tap.h>
+#include <atomic>
+
+/* A context owner which never waits: all requests are "nowait". */
+class Test_owner : public MDL_context_owner
+{
+public:
+  void enter_cond(mysql_cond_t *, mysql_mutex_t *, const PSI_stage_info *,
+                  PSI_stage_info *, const char *, const char *, int) override
+  {}
+  void exit_cond(const PSI_stage_info *, const char *, const char *,
+                 int) override
+  {}
+  int is_killed() override { return 0; }
+  THD *get_thd() override { return NULL; }
+  bool notify_shared_lock(MDL_context_owner *, bool) override
+  { return false; }
+};
+
+#define MAX_TABLES 4
+
+static std::atomic<uint> bad;
+static std::atomic<uint> granted_exclusive, granted_ftwrl;
+static std::atomic<uint> thread_number;
+static uint n_tables;
+static int n_cycles;
+
+/** number of shared table locks held on each table */
+static std::atomic<int> shared_holders[MAX_TABLES];
+/** whether an exclusive lock is held on each table */
+static std::atomic<bool> exclusive_holder[MAX_TABLES];
+/** number of MDL_BACKUP_DML held */
+static std::atomic<int> backup_dml_holders;
+/** whether MDL_BACKUP_FTWRL1 is held */
+static std::atomic<bool> ftwrl_holder;
+
+static void ignore_error(uint, const char *, myf) {}
+
+static void table_name(char (&name)[16], uint table)
+{
+  snprintf(name, sizeof name, "t%u", table);
+}
+
+/** Execute "statements" that read or write a table. */
+static void dml(MDL_context *mdl_context, uint offset)
+{
+  /* a table lock that is held across a few statements */
+  MDL_ticket *held= nullptr;
+
+  for (int i= 0; i < n_cycles; i++)
+  {
+    const uint table= (offset + i) % n_tables;
+    char name[16];
+    table_name(name, table);
+    MDL_request backup_request, table_request;
+    MDL_REQUEST_INIT(&backup_request, MDL_key::BACKUP, "", "",
+                     MDL_BACKUP_DML, MDL_STATEMENT);
+    MDL_REQUEST_INIT(&table_request, MDL_key::TABLE, "test", name,
+                     i & 1 ? MDL_SHARED_WRITE : MDL_SHARED_READ,
+                     i % 3 || held ? MDL_STATEMENT : MDL_EXPLICIT);
+
+    if (!mdl_context->acquire_lock(&backup_request, 0))
+    {
+      backup_dml_holders++;
+      if (ftwrl_holder)
+        bad++;
+
+      if (!mdl_context->acquire_lock(&table_request, 0))
+      {
+        shared_holders[table]++;
+        if (exclusive_holder[table])
+          bad++;
+        if (!mdl_context->is_lock_owner(MDL_key::TABLE, "test", name,
+                                        MDL_SHARED_READ) ||
+            !mdl_context->is_lock_owner(MDL_key::BACKUP, "", "",
+                                        MDL_BACKUP_DML))
+          bad++;
+        shared_holders[table]--;
+        if (table_request.duration == MDL_EXPLICIT)
+          held= table_request.ticket;
+      }
+
+      backup_dml_holders--;
+    }
+
+    mdl_context->release_statement_locks();
+    if (held && i % 3 == 2)
+    {
+      mdl_context->release_lock(held);
+      held= nullptr;
+    }
+  }
+
+  if (held)
+    mdl_context->release_lock(held);
+}
+
+/** Execute "statements" that need an exclusive table lock. */
+static void ddl(MDL_context *mdl_context, uint offset)
+{
+  for (int i= 0; i < n_cycles; i++)
+  {
+    const uint table= (offset + i) % n_tables;
+    char name[16];
+    table_name(name, table);
+    MDL_request table_request;
+    MDL_REQUEST_INIT(&table_request, MDL_key::TABLE, "test", name,
+                     MDL_EXCLUSIVE, MDL_STATEMENT);
+
+    if (!mdl_context->acquire_lock(&table_request, 0))
+    {
+      granted_exclusive++;
+      exclusive_holder[table]= true;
+      if (shared_holders[table])
+        bad++;
+      exclusive_holder[table]= false;
+    }
+
+    mdl_context->release_statement_locks();
+  }
+}
+
+/** Acquire the lock of FLUSH TABLES WITH READ LOCK. */
+static void ftwrl(MDL_context *mdl_context)
+{
+  for (int i= 0; i < n_cycles; i++)
+  {
+    MDL_request backup_request;
+    MDL_REQUEST_INIT(&backup_request, MDL_key::BACKUP, "", "",
+                     MDL_BACKUP_FTWRL1, MDL_STATEMENT);
+
+    if (!mdl_context->acquire_lock(&backup_request, 0))
+    {
+      granted_ftwrl++;
+      ftwrl_holder= true;
+      if (backup_dml_holders)
+        bad++;
+      ftwrl_holder= false;
+    }
+
+    mdl_context->release_statement_locks();
+  }
+}
+
+pthread_handler_t test_mdl_fast_path(void *)
+{
+  Test_owner owner;
+  my_thread_init();
+  const uint n= thread_number++;
+
+  {
+    MDL_context mdl_context;
+    mdl_context.init(&owner);
+
+    switch (n % 8) {
+    case 0:
+      ddl(&mdl_context, n);
+      break;
+    case 4:
+      ftwrl(&mdl_context);
+      break;
+    default:
+      dml(&mdl_context, n);
+    }
+
+    if (mdl_context.has_locks())
+      bad++;
+    mdl_context.destroy();
+  }
+
+  my_thread_end();
+  return 0;
+}
+
+static int count_locks(MDL_ticket *, void *arg, bool)
+{
+  (*static_cast<uint*>(arg))++;
+  return 0;
+}
+
+static void test_concurrently(uint tables, int n, int m)
+{
+  pthread_t *threads= new pthread_t[n];
+
+  bad= 0;
+  granted_exclusive= 0;
+  granted_ftwrl= 0;
+  thread_number= 0;
+  n_tables= tables;
+  n_cycles= m;
+
+  for (int i= 0; i < n; i++)
+  {
+    if (pthread_create(&threads[i], 0, test_mdl_fast_path, NULL) != 0)
+    {
+      diag("Could not create thread");
+      abort();
+    }
+  }
+
+  for (int i= 0; i < n; i++)
+    pthread_join(threads[i], 0);
+
+  delete[] threads;
+
+  uint tickets= 0;
+  mdl_iterate(count_locks, &tickets);
+
+  diag("%u exclusive and %u FTWRL locks were granted",
+       uint(granted_exclusive), uint(granted_ftwrl));
+  ok(!bad && !tickets, "%d threads, %u tables (%u, %u)", n, tables,
+     uint(bad), tickets);
+}
+
+int main(int argc __attribute__((unused)), char **argv)
+{
+  MY_INIT(argv[0]);
+
+  if (argv[1] && *argv[1])
+    DBUG_SET_INITIAL(argv[1]);
+
+  /* The nowait requests that fail would report ER_LOCK_WAIT_TIMEOUT */
+  error_handler_hook= ignore_error;
+
+#define CYCLES 20000
+#define THREADS 16
+
+  mdl_init();
+
+  plan(2);
+
+  test_concurrently(1, THREADS, CYCLES);
+  test_concurrently(MAX_TABLES, THREADS, CYCLES);
+
+  mdl_destroy();
+  my_end(0);
+  return exit_status();
+}